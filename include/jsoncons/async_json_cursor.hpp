@@ -0,0 +1,372 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_ASYNC_JSON_CURSOR_HPP
+#define JSONCONS_ASYNC_JSON_CURSOR_HPP
+
+#include <atomic>
+#include <functional> // std::function
+#include <memory> // std::allocator
+#include <string>
+#include <system_error>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/staj_cursor.hpp>
+#include <jsoncons/unicode_traits.hpp>
+#if defined(JSONCONS_HAS_COROUTINES)
+#include <coroutine>
+#endif
+
+namespace jsoncons {
+
+// A source of characters that completes its reads through a callback, for example a
+// non-blocking socket serviced by an event loop
+template <class CharT>
+class basic_async_source
+{
+public:
+    using char_type = CharT;
+    using read_handler = std::function<void(std::size_t,const std::error_code&)>;
+
+    virtual ~basic_async_source() noexcept = default;
+
+    // Starts reading up to length characters into data. The handler is called once,
+    // either before async_read returns or later, with the number of characters read,
+    // which is zero at the end of the input.
+    virtual void async_read(CharT* data, std::size_t length, read_handler handler) = 0;
+};
+
+template<class CharT,class Allocator=std::allocator<char>>
+class basic_async_json_cursor : private virtual ser_context
+{
+public:
+    using char_type = CharT;
+    using allocator_type = Allocator;
+    using source_type = basic_async_source<CharT>;
+    using completion_handler = std::function<void(const std::error_code&)>;
+private:
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<CharT> char_allocator_type;
+    static constexpr size_t default_max_buffer_length = 16384;
+
+    source_type* source_;
+    basic_json_parser<CharT,Allocator> parser_;
+    basic_staj_visitor<CharT> cursor_visitor_;
+    basic_json_visitor<CharT>* visitor_;
+    std::vector<CharT,char_allocator_type> buffer_;
+    std::size_t buffer_length_;
+    bool eof_;
+    bool begin_;
+    completion_handler handler_;
+    bool in_handler_;
+    bool started_;
+    std::atomic<bool> read_rendezvous_;
+    std::size_t read_count_;
+    std::error_code read_ec_;
+    bool settled_;
+    std::error_code settled_ec_;
+
+    // Noncopyable and nonmoveable
+    basic_async_json_cursor(const basic_async_json_cursor&) = delete;
+    basic_async_json_cursor& operator=(const basic_async_json_cursor&) = delete;
+
+public:
+    basic_async_json_cursor(source_type& source,
+                            const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>(),
+                            std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing(),
+                            const Allocator& alloc = Allocator())
+       : source_(std::addressof(source)),
+         parser_(options,err_handler,alloc),
+         cursor_visitor_(),
+         visitor_(std::addressof(cursor_visitor_)),
+         buffer_(alloc),
+         buffer_length_(default_max_buffer_length),
+         eof_(false),
+         begin_(true),
+         in_handler_(false),
+         started_(false),
+         read_rendezvous_(false),
+         read_count_(0),
+         settled_(false)
+    {
+    }
+
+    std::size_t buffer_length() const
+    {
+        return buffer_length_;
+    }
+
+    void buffer_length(std::size_t length)
+    {
+        buffer_length_ = length;
+    }
+
+    bool done() const
+    {
+        return parser_.done();
+    }
+
+    // The current event, valid after an async_next has completed without error
+    const basic_staj_event<CharT>& current() const
+    {
+        return cursor_visitor_.event();
+    }
+
+    const ser_context& context() const
+    {
+        return *this;
+    }
+
+    std::size_t line() const override
+    {
+        return parser_.line();
+    }
+
+    std::size_t column() const override
+    {
+        return parser_.column();
+    }
+
+    // Moves to the next event, the first event on the first call, and calls handler
+    // when it is current, when the input is done, or on error. Only one operation
+    // may be outstanding at a time.
+    void async_next(completion_handler handler)
+    {
+        start(std::addressof(cursor_visitor_), std::move(handler));
+        resume();
+    }
+
+    // Reports the current event and, if it begins an object or array, the rest of
+    // the value to visitor, then calls handler
+    void async_read_to(basic_json_visitor<CharT>& visitor, completion_handler handler)
+    {
+        std::error_code ec;
+        bool more = staj_to_saj_event(current(), visitor, *this, ec);
+        start(std::addressof(visitor), std::move(handler));
+        if (!more || ec)
+        {
+            settled_ = true;
+            settled_ec_ = ec;
+        }
+        resume();
+    }
+
+#if defined(JSONCONS_HAS_COROUTINES)
+
+    // An awaitable that suspends the awaiting coroutine only if the operation has to wait
+    // for input. The coroutine is resumed on the thread that completes the read.
+    class awaitable
+    {
+        basic_async_json_cursor* cursor_;
+        basic_json_visitor<CharT>* visitor_;
+        std::error_code* ec_ptr_;
+        std::error_code ec_;
+        std::atomic<bool> rendezvous_;
+        std::coroutine_handle<> awaiting_;
+    public:
+        awaitable(basic_async_json_cursor* cursor, basic_json_visitor<CharT>* visitor, std::error_code* ec_ptr)
+            : cursor_(cursor), visitor_(visitor), ec_ptr_(ec_ptr), rendezvous_(false)
+        {
+        }
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> awaiting)
+        {
+            awaiting_ = awaiting;
+            // Whichever of this and the handler comes second carries on
+            auto handler = [this](const std::error_code& ec)
+            {
+                ec_ = ec;
+                if (rendezvous_.exchange(true))
+                {
+                    awaiting_.resume();
+                }
+            };
+            if (visitor_ == nullptr)
+            {
+                cursor_->async_next(handler);
+            }
+            else
+            {
+                cursor_->async_read_to(*visitor_, handler);
+            }
+            return !rendezvous_.exchange(true);
+        }
+
+        void await_resume()
+        {
+            if (ec_ptr_ != nullptr)
+            {
+                *ec_ptr_ = ec_;
+            }
+            else if (ec_)
+            {
+                JSONCONS_THROW(ser_error(ec_,cursor_->line(),cursor_->column()));
+            }
+        }
+    };
+
+    awaitable next()
+    {
+        return awaitable(this, nullptr, nullptr);
+    }
+
+    awaitable next(std::error_code& ec)
+    {
+        return awaitable(this, nullptr, std::addressof(ec));
+    }
+
+    awaitable read_to(basic_json_visitor<CharT>& visitor)
+    {
+        return awaitable(this, std::addressof(visitor), nullptr);
+    }
+
+    awaitable read_to(basic_json_visitor<CharT>& visitor, std::error_code& ec)
+    {
+        return awaitable(this, std::addressof(visitor), std::addressof(ec));
+    }
+
+#endif // defined(JSONCONS_HAS_COROUTINES)
+
+private:
+    void start(basic_json_visitor<CharT>* visitor, completion_handler handler)
+    {
+        visitor_ = visitor;
+        handler_ = std::move(handler);
+        parser_.restart();
+    }
+
+    void resume()
+    {
+        if (in_handler_)
+        {
+            // Run by complete once the handler returns, so that a chain of
+            // operations that complete immediately doesn't grow the stack
+            started_ = true;
+            return;
+        }
+        std::error_code ec;
+        if (pump(ec))
+        {
+            complete(ec);
+        }
+    }
+
+    // Parses until the operation is done, returns false if it has to wait for input
+    bool pump(std::error_code& ec)
+    {
+        if (settled_)
+        {
+            settled_ = false;
+            ec = settled_ec_;
+            return true;
+        }
+        while (!parser_.stopped())
+        {
+            if (parser_.source_exhausted() && !eof_)
+            {
+                buffer_.resize(buffer_length_);
+                read_rendezvous_ = false;
+                source_->async_read(buffer_.data(), buffer_.size(),
+                                    [this](std::size_t count, const std::error_code& read_ec) {on_read(count, read_ec);});
+                // Whichever of this and on_read comes second carries on
+                if (!read_rendezvous_.exchange(true))
+                {
+                    return false;
+                }
+                accept_read(ec);
+                if (ec)
+                {
+                    return true;
+                }
+            }
+            parser_.parse_some(*visitor_, ec);
+            if (ec)
+            {
+                return true;
+            }
+        }
+        return true;
+    }
+
+    void on_read(std::size_t count, const std::error_code& ec)
+    {
+        read_count_ = count;
+        read_ec_ = ec;
+        if (read_rendezvous_.exchange(true))
+        {
+            std::error_code result;
+            accept_read(result);
+            if (result || pump(result))
+            {
+                complete(result);
+            }
+        }
+    }
+
+    void accept_read(std::error_code& ec)
+    {
+        if (read_ec_)
+        {
+            ec = read_ec_;
+            return;
+        }
+        if (read_count_ == 0)
+        {
+            eof_ = true;
+            return;
+        }
+        std::size_t offset = 0;
+        if (begin_)
+        {
+            auto result = unicons::skip_bom(buffer_.begin(), buffer_.begin() + read_count_);
+            if (result.ec != unicons::encoding_errc())
+            {
+                ec = result.ec;
+                return;
+            }
+            offset = result.it - buffer_.begin();
+            begin_ = false;
+        }
+        parser_.update(buffer_.data()+offset,read_count_-offset);
+    }
+
+    void complete(std::error_code ec)
+    {
+        do
+        {
+            completion_handler handler = std::move(handler_);
+            handler_ = nullptr;
+            started_ = false;
+            in_handler_ = true;
+            handler(ec);
+            in_handler_ = false;
+            if (!started_)
+            {
+                return;
+            }
+            ec = std::error_code();
+        }
+        while (pump(ec));
+    }
+};
+
+using async_source = basic_async_source<char>;
+using wasync_source = basic_async_source<wchar_t>;
+
+using async_json_cursor = basic_async_json_cursor<char>;
+using wasync_json_cursor = basic_async_json_cursor<wchar_t>;
+
+} // namespace jsoncons
+
+#endif
@@ -28,6 +28,8 @@
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/pretty_print.hpp>
 #include <jsoncons/json_container_types.hpp>
+#include <jsoncons/json_builder.hpp>
+#include <jsoncons/interned_key.hpp>
 #include <jsoncons/bigint.hpp>
 #include <jsoncons/json_options.hpp>
 #include <jsoncons/json_encoder.hpp>
@@ -37,6 +39,7 @@
 #include <jsoncons/byte_string.hpp>
 #include <jsoncons/json_error.hpp>
 #include <jsoncons/detail/string_wrapper.hpp>
+#include <jsoncons/detail/typed_array_wrapper.hpp>
 
 namespace jsoncons { 
 
@@ -249,6 +252,40 @@ struct preserve_order_policy : public sorted_policy
     using key_order = preserve_key_order;
 };
 
+struct interned_sorted_policy : public sorted_policy
+{
+    template <class CharT, class CharTraits, class Allocator>
+    using key_storage = basic_interned_key<CharT, CharTraits, Allocator>;
+};
+
+struct interned_preserve_order_policy : public preserve_order_policy
+{
+    template <class CharT, class CharTraits, class Allocator>
+    using key_storage = basic_interned_key<CharT, CharTraits, Allocator>;
+};
+
+// json_memory_usage
+
+// Bytes allocated by a basic_json value and its nested values, by kind
+struct json_memory_usage
+{
+    std::size_t strings;    // long strings and byte strings
+    std::size_t arrays;     // array buffers and packed typed arrays
+    std::size_t objects;    // object buffers and lookup indexes
+    std::size_t keys;       // member names held outside the object buffers
+    std::size_t slack;      // unused capacity of array, object and key buffers
+
+    json_memory_usage() noexcept
+        : strings(0), arrays(0), objects(0), keys(0), slack(0)
+    {
+    }
+
+    std::size_t total() const noexcept
+    {
+        return strings + arrays + objects + keys + slack;
+    }
+};
+
 template <class IteratorT, class ConstIteratorT>
 class range 
 {
@@ -337,7 +374,7 @@ public:
 
     using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type>;
 
-    using key_type = std::basic_string<char_type,char_traits_type,char_allocator_type>;
+    using key_type = typename implementation_policy::template key_storage<char_type,char_traits_type,char_allocator_type>;
 
 
     using reference = basic_json&;
@@ -365,6 +402,9 @@ public:
     using array_iterator = typename array::iterator;
     using const_array_iterator = typename array::const_iterator;
 
+    using object_builder = basic_object_builder<basic_json>;
+    using array_builder = basic_array_builder<basic_json>;
+
 private:
 
     static constexpr uint8_t major_type_shift = 0x04;
@@ -622,6 +662,121 @@ private:
             return s_.length();
         }
 
+        std::size_t allocated_size() const
+        {
+            return s_.allocated_size();
+        }
+
+        allocator_type get_allocator() const
+        {
+            return s_.get_allocator();
+        }
+    };
+
+    // borrowed_string_storage
+    class borrowed_string_storage final
+    {
+    public:
+        uint8_t storage_:4;
+        uint8_t length_:4;
+        semantic_tag tag_;
+    private:
+        uint32_t size_;
+        const char_type* data_;
+    public:
+        static constexpr std::size_t max_length = (std::numeric_limits<uint32_t>::max)();
+
+        borrowed_string_storage(semantic_tag tag, const char_type* data, std::size_t length)
+            : storage_(static_cast<uint8_t>(storage_kind::borrowed_string_value)), length_(0), tag_(tag),
+              size_(static_cast<uint32_t>(length)), data_(data)
+        {
+            JSONCONS_ASSERT(length <= max_length);
+        }
+
+        const char_type* data() const
+        {
+            return data_;
+        }
+
+        std::size_t length() const
+        {
+            return size_;
+        }
+    };
+
+    // typed_array_storage
+    class typed_array_storage final
+    {
+    public:
+        uint8_t storage_:4;
+        uint8_t length_:4;
+        semantic_tag tag_;
+    private:
+        jsoncons::detail::typed_array_wrapper<Allocator> s_;
+    public:
+
+        template <class T>
+        typed_array_storage(typed_array_type type, semantic_tag tag, const T* data, std::size_t size, const Allocator& alloc)
+            : storage_(static_cast<uint8_t>(storage_kind::typed_array_value)), length_(static_cast<uint8_t>(type)), tag_(tag),
+              s_(data, size, alloc)
+        {
+        }
+
+        typed_array_storage(const typed_array_storage& val)
+            : storage_(val.storage_), length_(val.length_), tag_(val.tag_),
+              s_(val.s_)
+        {
+        }
+
+        typed_array_storage(typed_array_storage&& val) noexcept
+            : storage_(val.storage_), length_(val.length_), tag_(val.tag_),
+              s_(nullptr)
+        {
+            swap(val);
+        }
+
+        typed_array_storage(const typed_array_storage& val, const Allocator& a)
+            : storage_(val.storage_), length_(val.length_), tag_(val.tag_),
+              s_(val.s_, a)
+        {
+        }
+
+        ~typed_array_storage() noexcept
+        {
+        }
+
+        void swap(typed_array_storage& val) noexcept
+        {
+            s_.swap(val.s_);
+        }
+
+        typed_array_type type() const
+        {
+            return static_cast<typed_array_type>(length_);
+        }
+
+        template <class T>
+        const T* data() const
+        {
+            return s_.template data<T>();
+        }
+
+        template <class T>
+        T* data()
+        {
+            return s_.template data<T>();
+        }
+
+        std::size_t size() const
+        {
+            return s_.size();
+        }
+
+        std::size_t allocated_size() const
+        {
+            return s_.allocated_size();
+        }
+
         allocator_type get_allocator() const
         {
             return s_.get_allocator();
@@ -688,6 +843,11 @@ private:
             return s_.tag();
         }
 
+        std::size_t allocated_size() const
+        {
+            return s_.allocated_size();
+        }
+
         allocator_type get_allocator() const
         {
             return s_.get_allocator();
@@ -777,8 +937,10 @@ private:
             std::swap(val.ptr_,ptr_);
         }
 
+        // Non-const access may modify the array, so discards its cached hash
         array& value()
         {
+            ptr_->invalidate_hash();
             return *ptr_;
         }
 
@@ -860,8 +1022,10 @@ private:
             std::swap(val.ptr_,ptr_);
         }
 
+        // Non-const access may modify the object, so discards its cached hash
         object& value()
         {
+            ptr_->invalidate_hash();
             return *ptr_;
         }
 
@@ -1075,6 +1239,11 @@ private:
             return evaluate().capacity();
         }
 
+        json_memory_usage memory_usage() const
+        {
+            return evaluate().memory_usage();
+        }
+
         void reserve(std::size_t n)
         {
             evaluate().reserve(n);
@@ -1181,6 +1350,42 @@ private:
             return evaluate().is_array();
         }
 
+        bool is_typed_array() const noexcept
+        {
+            if (!parent_.contains(key_))
+            {
+                return false;
+            }
+            return evaluate().is_typed_array();
+        }
+
+        std::size_t hash() const
+        {
+            return evaluate().hash();
+        }
+
+        typed_array_type typed_element_type() const
+        {
+            return evaluate().typed_element_type();
+        }
+
+        template <class T>
+        jsoncons::span<const T> as_span() const
+        {
+            return evaluate().template as_span<T>();
+        }
+
+        template <class T>
+        jsoncons::span<T> as_span()
+        {
+            return evaluate().template as_span<T>();
+        }
+
+        basic_json typed_element(std::size_t i) const
+        {
+            return evaluate().typed_element(i);
+        }
+
         bool is_int64() const noexcept
         {
             if (!parent_.contains(key_))
@@ -1347,6 +1552,11 @@ private:
             return evaluate().template get_value_or<T,U>(name,std::forward<U>(default_value));
         }
 
+        void unpack()
+        {
+            evaluate().unpack();
+        }
+
         void shrink_to_fit()
         {
             evaluate_with_default().shrink_to_fit();
@@ -1888,6 +2098,8 @@ private:
         double_storage double_stor_;
         short_string_storage short_string_stor_;
         long_string_storage long_string_stor_;
+        borrowed_string_storage borrowed_string_stor_;
+        typed_array_storage typed_array_stor_;
         byte_string_storage byte_string_stor_;
         array_storage array_stor_;
         object_storage object_stor_;
@@ -1905,6 +2117,9 @@ private:
             case storage_kind::byte_string_value:
                 destroy_var<byte_string_storage>();
                 break;
+            case storage_kind::typed_array_value:
+                destroy_var<typed_array_storage>();
+                break;
             case storage_kind::array_value:
                 destroy_var<array_storage>();
                 break;
@@ -2033,6 +2248,16 @@ private:
         return long_string_stor_;
     }
 
+    borrowed_string_storage& cast(identity<borrowed_string_storage>)
+    {
+        return borrowed_string_stor_;
+    }
+
+    const borrowed_string_storage& cast(identity<borrowed_string_storage>) const
+    {
+        return borrowed_string_stor_;
+    }
+
     byte_string_storage& cast(identity<byte_string_storage>)
     {
         return byte_string_stor_;
@@ -2053,6 +2278,16 @@ private:
         return object_stor_;
     }
 
+    typed_array_storage& cast(identity<typed_array_storage>)
+    {
+        return typed_array_stor_;
+    }
+
+    const typed_array_storage& cast(identity<typed_array_storage>) const
+    {
+        return typed_array_stor_;
+    }
+
     array_storage& cast(identity<array_storage>)
     {
         return array_stor_;
@@ -2097,7 +2332,9 @@ private:
             case storage_kind::double_value       : swap_a_b<TypeA, double_storage>(other); break;
             case storage_kind::short_string_value : swap_a_b<TypeA, short_string_storage>(other); break;
             case storage_kind::long_string_value       : swap_a_b<TypeA, long_string_storage>(other); break;
+            case storage_kind::borrowed_string_value   : swap_a_b<TypeA, borrowed_string_storage>(other); break;
             case storage_kind::byte_string_value  : swap_a_b<TypeA, byte_string_storage>(other); break;
+            case storage_kind::typed_array_value  : swap_a_b<TypeA, typed_array_storage>(other); break;
             case storage_kind::array_value        : swap_a_b<TypeA, array_storage>(other); break;
             case storage_kind::object_value       : swap_a_b<TypeA, object_storage>(other); break;
             case storage_kind::json_const_pointer : swap_a_b<TypeA, json_const_pointer_storage>(other); break;
@@ -2138,9 +2375,15 @@ private:
             case storage_kind::long_string_value:
                 construct<long_string_storage>(val.cast<long_string_storage>());
                 break;
+            case storage_kind::borrowed_string_value:
+                construct<borrowed_string_storage>(val.cast<borrowed_string_storage>());
+                break;
             case storage_kind::byte_string_value:
                 construct<byte_string_storage>(val.cast<byte_string_storage>());
                 break;
+            case storage_kind::typed_array_value:
+                construct<typed_array_storage>(val.cast<typed_array_storage>());
+                break;
             case storage_kind::object_value:
                 construct<object_storage>(val.cast<object_storage>());
                 break;
@@ -2167,6 +2410,7 @@ private:
             case storage_kind::half_value:
             case storage_kind::double_value:
             case storage_kind::short_string_value:
+            case storage_kind::borrowed_string_value:
             case storage_kind::json_const_pointer:
                 Init_(val);
                 break;
@@ -2176,6 +2420,9 @@ private:
             case storage_kind::byte_string_value:
                 construct<byte_string_storage>(val.cast<byte_string_storage>(),a);
                 break;
+            case storage_kind::typed_array_value:
+                construct<typed_array_storage>(val.cast<typed_array_storage>(),a);
+                break;
             case storage_kind::array_value:
                 construct<array_storage>(val.cast<array_storage>(),a);
                 break;
@@ -2199,11 +2446,13 @@ private:
             case storage_kind::uint64_value:
             case storage_kind::bool_value:
             case storage_kind::short_string_value:
+            case storage_kind::borrowed_string_value:
             case storage_kind::json_const_pointer:
                 Init_(val);
                 break;
             case storage_kind::long_string_value:
             case storage_kind::byte_string_value:
+            case storage_kind::typed_array_value:
             case storage_kind::array_value:
             case storage_kind::object_value:
             {
@@ -2234,6 +2483,7 @@ private:
             case storage_kind::uint64_value:
             case storage_kind::bool_value:
             case storage_kind::short_string_value:
+            case storage_kind::borrowed_string_value:
             case storage_kind::json_const_pointer:
                 Init_(std::forward<basic_json>(val));
                 break;
@@ -2261,6 +2511,18 @@ private:
                 }
                 break;
             }
+            case storage_kind::typed_array_value:
+            {
+                if (a == val.cast<typed_array_storage>().get_allocator())
+                {
+                    Init_rv_(std::forward<basic_json>(val), a, std::true_type());
+                }
+                else
+                {
+                    Init_(val,a);
+                }
+                break;
+            }
             case storage_kind::object_value:
             {
                 if (a == val.cast<object_storage>().get_allocator())
@@ -2363,10 +2625,12 @@ public:
                 return json_type::double_value;
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
                 return json_type::string_value;
             case storage_kind::byte_string_value:
                 return json_type::byte_string_value;
             case storage_kind::array_value:
+            case storage_kind::typed_array_value:
                 return json_type::array_value;
             case storage_kind::empty_object_value:
             case storage_kind::object_value:
@@ -2400,6 +2664,8 @@ public:
         {
             case storage_kind::array_value:
                 return cast<array_storage>().value().size();
+            case storage_kind::typed_array_value:
+                return cast<typed_array_storage>().size();
             case storage_kind::empty_object_value:
                 return 0;
             case storage_kind::object_value:
@@ -2419,6 +2685,8 @@ public:
                 return string_view_type(cast<short_string_storage>().data(),cast<short_string_storage>().length());
             case storage_kind::long_string_value:
                 return string_view_type(cast<long_string_storage>().data(),cast<long_string_storage>().length());
+            case storage_kind::borrowed_string_value:
+                return string_view_type(cast<borrowed_string_storage>().data(),cast<borrowed_string_storage>().length());
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->as_string_view();
             default:
@@ -2437,6 +2705,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
             {
                 byte_string_type v = convert.from(as_string_view(),tag(),ec);
                 if (ec)
@@ -2467,6 +2736,257 @@ public:
         }
     }
 
+    // Values that compare equal have equal hashes. Object hashes do not depend on member order,
+    // so are the same for sorted and order preserving policies. The hashes of arrays and objects 
+    // are cached until they are next accessed through a non-const member function.
+    std::size_t hash() const noexcept
+    {
+        switch (storage())
+        {
+            case storage_kind::null_value:
+                return hash_mix(0x01);
+            case storage_kind::bool_value:
+                return hash_mix(cast<bool_storage>().value() ? 0x03 : 0x02);
+            case storage_kind::int64_value:
+                return hash_number(static_cast<double>(cast<int64_storage>().value()));
+            case storage_kind::uint64_value:
+                return hash_number(static_cast<double>(cast<uint64_storage>().value()));
+            case storage_kind::half_value:
+                return hash_number(jsoncons::detail::decode_half(cast<half_storage>().value()));
+            case storage_kind::double_value:
+                return hash_number(cast<double_storage>().value());
+            case storage_kind::short_string_value:
+            case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
+                return hash_chars(0x05, as_string_view());
+            case storage_kind::byte_string_value:
+                return hash_chars(0x06, as_byte_string_view());
+            case storage_kind::typed_array_value:
+            {
+                std::size_t h = hash_mix(0x07);
+                for (std::size_t i = 0; i < size(); ++i)
+                {
+                    h = hash_combine(h, typed_element(i).hash());
+                }
+                return hash_mix(h + size());
+            }
+            case storage_kind::array_value:
+            {
+                const auto& a = cast<array_storage>().value();
+                std::size_t h = a.cached_hash();
+                if (h == 0)
+                {
+                    h = hash_mix(0x07);
+                    for (const auto& item : a)
+                    {
+                        h = hash_combine(h, item.hash());
+                    }
+                    h = nonzero_hash(hash_mix(h + a.size()));
+                    a.cache_hash(h);
+                }
+                return h;
+            }
+            case storage_kind::empty_object_value:
+                return nonzero_hash(hash_mix(0x08));
+            case storage_kind::object_value:
+            {
+                const auto& o = cast<object_storage>().value();
+                std::size_t h = o.cached_hash();
+                if (h == 0)
+                {
+                    // Summing member hashes makes the result independent of member order
+                    std::size_t sum = 0;
+                    for (const auto& member : o)
+                    {
+                        sum += hash_mix(hash_combine(hash_chars(0x05, string_view_type(member.key().data(), member.key().size())), 
+                                                     member.value().hash()));
+                    }
+                    h = nonzero_hash(hash_mix(hash_mix(0x08) + sum));
+                    o.cache_hash(h);
+                }
+                return h;
+            }
+            case storage_kind::json_const_pointer:
+                return cast<json_const_pointer_storage>().value()->hash();
+            default:
+                JSONCONS_UNREACHABLE();
+                break;
+        }
+    }
+
+    // Returns the cached hash of an array or object, or zero if none has been computed
+    std::size_t cached_hash() const noexcept
+    {
+        switch (storage())
+        {
+            case storage_kind::array_value:
+                return cast<array_storage>().value().cached_hash();
+            case storage_kind::object_value:
+                return cast<object_storage>().value().cached_hash();
+            case storage_kind::json_const_pointer:
+                return cast<json_const_pointer_storage>().value()->cached_hash();
+            default:
+                return 0;
+        }
+    }
+
+private:
+    static std::size_t hash_mix(uint64_t x) noexcept
+    {
+        // splitmix64 finalizer
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ULL;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebULL;
+        x ^= x >> 31;
+        return static_cast<std::size_t>(x);
+    }
+
+    static std::size_t hash_combine(std::size_t seed, std::size_t h) noexcept
+    {
+        return seed ^ (h + static_cast<std::size_t>(0x9e3779b97f4a7c15ULL) + (seed << 6) + (seed >> 2));
+    }
+
+    static std::size_t nonzero_hash(std::size_t h) noexcept
+    {
+        return h == 0 ? 1 : h;
+    }
+
+    // Numbers that compare equal hash equal, integers are compared with doubles as doubles
+    static std::size_t hash_number(double val) noexcept
+    {
+        if (val == 0.0)
+        {
+            val = 0.0; // -0.0
+        }
+        uint64_t bits;
+        std::memcpy(&bits, &val, sizeof(double));
+        return hash_mix(bits ^ 0x04);
+    }
+
+    template <class Sequence>
+    static std::size_t hash_chars(uint64_t seed, const Sequence& s) noexcept
+    {
+        // FNV-1a
+        uint64_t h = 14695981039346656037ULL ^ seed;
+        for (auto c : s)
+        {
+            h ^= static_cast<uint64_t>(c);
+            h *= 1099511628211ULL;
+        }
+        return hash_mix(h);
+    }
+
+    // Orders values of different storage kinds, a borrowed string ranks with the other string kinds
+    static int storage_rank(storage_kind kind) noexcept
+    {
+        switch (kind)
+        {
+            case storage_kind::borrowed_string_value:
+                return static_cast<int>(storage_kind::long_string_value);
+            case storage_kind::typed_array_value:
+                return static_cast<int>(storage_kind::array_value);
+            default:
+                return static_cast<int>(kind);
+        }
+    }
+
+    // True if both values have cached hashes and these differ
+    bool known_unequal(const basic_json& rhs) const noexcept
+    {
+        std::size_t lhs_hash = cached_hash();
+        std::size_t rhs_hash = rhs.cached_hash();
+        return lhs_hash != 0 && rhs_hash != 0 && lhs_hash != rhs_hash;
+    }
+
+    void add_memory_usage(json_memory_usage& usage) const
+    {
+        switch (storage())
+        {
+            case storage_kind::long_string_value:
+                usage.strings += cast<long_string_storage>().allocated_size();
+                break;
+            case storage_kind::byte_string_value:
+                usage.strings += cast<byte_string_storage>().allocated_size();
+                break;
+            case storage_kind::typed_array_value:
+                usage.arrays += cast<typed_array_storage>().allocated_size();
+                break;
+            case storage_kind::array_value:
+            {
+                const array& a = cast<array_storage>().value();
+                usage.arrays += sizeof(array) + a.size()*sizeof(basic_json);
+                usage.slack += (a.capacity() - a.size())*sizeof(basic_json);
+                for (const auto& item : a)
+                {
+                    item.add_memory_usage(usage);
+                }
+                break;
+            }
+            case storage_kind::object_value:
+            {
+                const object& o = cast<object_storage>().value();
+                const std::size_t index_size = (std::min)(o.size(), o.index_capacity());
+                usage.objects += sizeof(object) + o.size()*sizeof(key_value_type) + index_size*sizeof(std::size_t);
+                usage.slack += (o.capacity() - o.size())*sizeof(key_value_type) + (o.index_capacity() - index_size)*sizeof(std::size_t);
+                const std::size_t inline_capacity = inline_key_capacity(o.get_allocator(), jsoncons::detail::is_interned_key<key_type>());
+                for (const auto& member : o)
+                {
+                    add_key_memory_usage(member.key(), inline_capacity, usage, jsoncons::detail::is_interned_key<key_type>());
+                    member.value().add_memory_usage(usage);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Capacity of a key that holds its characters without allocating
+    static std::size_t inline_key_capacity(const Allocator& alloc, std::false_type)
+    {
+        return key_type(char_allocator_type(alloc)).capacity();
+    }
+
+    static std::size_t inline_key_capacity(const Allocator&, std::true_type)
+    {
+        return 0;
+    }
+
+    static void add_key_memory_usage(const key_type& key, std::size_t inline_capacity, json_memory_usage& usage, std::false_type)
+    {
+        if (key.capacity() > inline_capacity)
+        {
+            usage.keys += (key.length() + 1)*sizeof(char_type);
+            usage.slack += (key.capacity() - key.length())*sizeof(char_type);
+        }
+    }
+
+    // Interned keys share buffers owned by their intern table
+    static void add_key_memory_usage(const key_type&, std::size_t, json_memory_usage&, std::true_type)
+    {
+    }
+
+    // Compares arrays element by element when either is a typed array
+    int compare_elements(const basic_json& rhs) const noexcept
+    {
+        std::size_t n = (std::min)(size(), rhs.size());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            basic_json lhs_item = storage() == storage_kind::typed_array_value ? typed_element(i) : basic_json();
+            basic_json rhs_item = rhs.storage() == storage_kind::typed_array_value ? rhs.typed_element(i) : basic_json();
+            const basic_json& a = storage() == storage_kind::typed_array_value ? lhs_item : cast<array_storage>().value()[i];
+            const basic_json& b = rhs.storage() == storage_kind::typed_array_value ? rhs_item : rhs.cast<array_storage>().value()[i];
+            int diff = a.compare(b);
+            if (diff != 0)
+            {
+                return diff;
+            }
+        }
+        return size() == rhs.size() ? 0 : (size() < rhs.size() ? -1 : 1);
+    }
+public:
+
     int compare(const basic_json& rhs) const noexcept
     {
         if (this == &rhs)
@@ -2485,7 +3005,7 @@ public:
                 }
                 break;
             case storage_kind::null_value:
-                return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                return storage_rank(storage()) - storage_rank(rhs.storage());
             case storage_kind::empty_object_value:
                 switch (rhs.storage())
                 {
@@ -2496,7 +3016,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::bool_value:
@@ -2507,7 +3027,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::int64_value:
@@ -2534,7 +3054,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::uint64_value:
@@ -2560,7 +3080,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::double_value:
@@ -2584,21 +3104,24 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
                 switch (rhs.storage())
                 {
                     case storage_kind::short_string_value:
                         return as_string_view().compare(rhs.as_string_view());
                     case storage_kind::long_string_value:
                         return as_string_view().compare(rhs.as_string_view());
+                    case storage_kind::borrowed_string_value:
+                        return as_string_view().compare(rhs.as_string_view());
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::byte_string_value:
@@ -2611,7 +3134,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::array_value:
@@ -2619,15 +3142,29 @@ public:
                 {
                     case storage_kind::array_value:
                     {
-                        if (cast<array_storage>().value() == rhs.cast<array_storage>().value())
+                        if (!known_unequal(rhs) && cast<array_storage>().value() == rhs.cast<array_storage>().value())
                             return 0; 
                         else 
                             return cast<array_storage>().value() < rhs.cast<array_storage>().value() ? -1 : 1;
                     }
+                    case storage_kind::typed_array_value:
+                        return compare_elements(rhs);
+                    case storage_kind::json_const_pointer:
+                        return compare(*(rhs.cast<json_const_pointer_storage>().value()));
+                    default:
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
+                }
+                break;
+            case storage_kind::typed_array_value:
+                switch (rhs.storage())
+                {
+                    case storage_kind::array_value:
+                    case storage_kind::typed_array_value:
+                        return compare_elements(rhs);
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             case storage_kind::object_value:
@@ -2637,7 +3174,7 @@ public:
                         return empty() ? 0 : 1;
                     case storage_kind::object_value:
                     {
-                        if (cast<object_storage>().value() == rhs.cast<object_storage>().value())
+                        if (!known_unequal(rhs) && cast<object_storage>().value() == rhs.cast<object_storage>().value())
                             return 0; 
                         else 
                             return cast<object_storage>().value() < rhs.cast<object_storage>().value() ? -1 : 1;
@@ -2645,7 +3182,7 @@ public:
                     case storage_kind::json_const_pointer:
                         return compare(*(rhs.cast<json_const_pointer_storage>().value()));
                     default:
-                        return static_cast<int>(storage()) - static_cast<int>((int)rhs.storage());
+                        return storage_rank(storage()) - storage_rank(rhs.storage());
                 }
                 break;
             default:
@@ -2672,7 +3209,9 @@ public:
             case storage_kind::double_value: swap_a<double_storage>(other); break;
             case storage_kind::short_string_value: swap_a<short_string_storage>(other); break;
             case storage_kind::long_string_value: swap_a<long_string_storage>(other); break;
+            case storage_kind::borrowed_string_value: swap_a<borrowed_string_storage>(other); break;
             case storage_kind::byte_string_value: swap_a<byte_string_storage>(other); break;
+            case storage_kind::typed_array_value: swap_a<typed_array_storage>(other); break;
             case storage_kind::array_value: swap_a<array_storage>(other); break;
             case storage_kind::object_value: swap_a<object_storage>(other); break;
             case storage_kind::json_const_pointer: swap_a<json_const_pointer_storage>(other); break;
@@ -2689,8 +3228,32 @@ public:
     parse(const Source& s, 
           const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>(), 
           std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+    {
+        return parse_string(s, options, err_handler, options.borrow_strings());
+    }
+
+    // Strings cannot be borrowed from a temporary that owns its characters, they are copied
+    template <class Source>
+    static
+    typename std::enable_if<jsoncons::detail::is_sequence_of<Source,char_type>::value &&
+                            !std::is_lvalue_reference<Source>::value &&
+                            !jsoncons::detail::is_basic_string_view<Source>::value,basic_json>::type
+    parse(Source&& s, 
+          const basic_json_decode_options<char_type>& options = basic_json_decode_options<CharT>(), 
+          std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
+    {
+        return parse_string(s, options, err_handler, false);
+    }
+
+private:
+    template <class Source>
+    static basic_json parse_string(const Source& s, 
+                                   const basic_json_decode_options<char_type>& options, 
+                                   std::function<bool(json_errc,const ser_context&)> err_handler,
+                                   bool borrow_strings)
     {
         json_decoder<basic_json> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         basic_json_parser<char_type> parser(options,err_handler);
 
         auto result = unicons::skip_bom(s.begin(), s.end());
@@ -2699,6 +3262,10 @@ public:
             JSONCONS_THROW(ser_error(result.ec));
         }
         std::size_t offset = result.it - s.begin();
+        if (borrow_strings)
+        {
+            decoder.borrow_strings_from(string_view_type(s.data(), s.size()));
+        }
         parser.update(s.data()+offset,s.size()-offset);
         parser.parse_some(decoder);
         parser.finish_parse(decoder);
@@ -2709,6 +3276,7 @@ public:
         }
         return decoder.get_result();
     }
+public:
 
     template <class Source>
     static
@@ -2739,6 +3307,7 @@ public:
                             std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
     {
         json_decoder<basic_json> visitor;
+        visitor.pack_numeric_arrays(options.pack_numeric_arrays());
         basic_json_reader<char_type,stream_source<char_type>> reader(is, visitor, options, err_handler);
         reader.read_next();
         reader.check_done();
@@ -2762,6 +3331,7 @@ public:
                             std::function<bool(json_errc,const ser_context&)> err_handler = default_json_parsing())
     {
         json_decoder<basic_json> visitor;
+        visitor.pack_numeric_arrays(options.pack_numeric_arrays());
         basic_json_reader<char_type,iterator_source<InputIt>> reader(iterator_source<InputIt>(std::forward<InputIt>(first),std::forward<InputIt>(last)), visitor, options, err_handler);
         reader.read_next();
         reader.check_done();
@@ -3100,6 +3670,48 @@ public:
     {
     }
 
+    // References the characters of sv without copying them, the caller must keep them alive 
+    // for the lifetime of this value or call materialize(). Strings short enough to be stored 
+    // inline are copied, as are strings too long to be borrowed, using alloc.
+    basic_json(borrowed_string_arg_t, const string_view_type& sv, semantic_tag tag = semantic_tag::none)
+        : basic_json(borrowed_string_arg, sv, tag, Allocator())
+    {
+    }
+
+    basic_json(borrowed_string_arg_t, const string_view_type& sv, semantic_tag tag, const Allocator& alloc)
+    {
+        if (sv.length() <= short_string_storage::max_length)
+        {
+            construct<short_string_storage>(tag, sv.data(), static_cast<uint8_t>(sv.length()));
+        }
+        else if (sv.length() <= borrowed_string_storage::max_length)
+        {
+            construct<borrowed_string_storage>(tag, sv.data(), sv.length());
+        }
+        else
+        {
+            construct<long_string_storage>(tag, sv.data(), sv.length(), alloc);
+        }
+    }
+
+    // Packs the elements into a single allocation rather than one basic_json value per element
+    template <class T>
+    basic_json(typed_array_arg_t, const jsoncons::span<T>& data, 
+               semantic_tag tag = semantic_tag::none, 
+               const Allocator& alloc = Allocator())
+    {
+        using value_type = typename std::remove_const<T>::type;
+        construct<typed_array_storage>(jsoncons::detail::typed_array_type_of<value_type>::value, tag, 
+                                       data.data(), data.size(), alloc);
+    }
+
+    basic_json(typed_array_arg_t, half_arg_t, const jsoncons::span<const uint16_t>& data, 
+               semantic_tag tag = semantic_tag::none, 
+               const Allocator& alloc = Allocator())
+    {
+        construct<typed_array_storage>(typed_array_type::half_value, tag, data.data(), data.size(), alloc);
+    }
+
     template <class Source>
     basic_json(byte_string_arg_t, const Source& source, 
                semantic_tag tag = semantic_tag::none,
@@ -3455,6 +4067,10 @@ public:
             {
                 return cast<byte_string_storage>().get_allocator();
             }
+            case storage_kind::typed_array_value:
+            {
+                return cast<typed_array_storage>().get_allocator();
+            }
             case storage_kind::array_value:
             {
                 return cast<array_storage>().get_allocator();
@@ -3537,6 +4153,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
                 return true;
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->is_string();
@@ -3574,6 +4191,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
                 return jsoncons::detail::is_base10(as_string_view().data(), as_string_view().length());
             case storage_kind::int64_value:
             case storage_kind::uint64_value:
@@ -3617,6 +4235,7 @@ public:
         switch (storage())
         {
             case storage_kind::array_value:
+            case storage_kind::typed_array_value:
                 return true;
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->is_array();
@@ -3625,6 +4244,32 @@ public:
         }
     }
 
+    bool is_typed_array() const noexcept
+    {
+        switch (storage())
+        {
+            case storage_kind::typed_array_value:
+                return true;
+            case storage_kind::json_const_pointer:
+                return cast<json_const_pointer_storage>().value()->is_typed_array();
+            default:
+                return false;
+        }
+    }
+
+    typed_array_type typed_element_type() const
+    {
+        switch (storage())
+        {
+            case storage_kind::typed_array_value:
+                return cast<typed_array_storage>().type();
+            case storage_kind::json_const_pointer:
+                return cast<json_const_pointer_storage>().value()->typed_element_type();
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a typed array"));
+        }
+    }
+
     bool is_int64() const noexcept
     {
         switch (storage())
@@ -3692,6 +4337,7 @@ public:
                 return true;
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
                 return tag() == semantic_tag::bigint ||
                        tag() == semantic_tag::bigdec ||
                        tag() == semantic_tag::bigfloat;
@@ -3713,8 +4359,12 @@ public:
                 return cast<short_string_storage>().length() == 0;
             case storage_kind::long_string_value:
                 return cast<long_string_storage>().length() == 0;
+            case storage_kind::borrowed_string_value:
+                return cast<borrowed_string_storage>().length() == 0;
             case storage_kind::array_value:
                 return array_value().empty();
+            case storage_kind::typed_array_value:
+                return cast<typed_array_storage>().size() == 0;
             case storage_kind::empty_object_value:
                 return true;
             case storage_kind::object_value:
@@ -3732,6 +4382,8 @@ public:
         {
             case storage_kind::array_value:
                 return array_value().capacity();
+            case storage_kind::typed_array_value:
+                return cast<typed_array_storage>().size();
             case storage_kind::object_value:
                 return object_value().capacity();
             case storage_kind::json_const_pointer:
@@ -3741,6 +4393,16 @@ public:
         }
     }
 
+    // Returns the bytes allocated by this value and its nested values. The 
+    // basic_json itself, the targets of json_const_pointer values, borrowed
+    // strings and interned keys are not counted.
+    json_memory_usage memory_usage() const
+    {
+        json_memory_usage usage;
+        add_memory_usage(usage);
+        return usage;
+    }
+
     template<class U=Allocator>
     void create_object_implicitly()
     {
@@ -3766,6 +4428,10 @@ public:
                 case storage_kind::array_value:
                     array_value().reserve(n);
                     break;
+                case storage_kind::typed_array_value:
+                    unpack();
+                    array_value().reserve(n);
+                    break;
                 case storage_kind::empty_object_value:
                 {
                     create_object_implicitly();
@@ -3790,6 +4456,10 @@ public:
             case storage_kind::array_value:
                 array_value().resize(n);
                 break;
+            case storage_kind::typed_array_value:
+                unpack();
+                array_value().resize(n);
+                break;
             default:
                 break;
         }
@@ -3803,6 +4473,10 @@ public:
             case storage_kind::array_value:
                 array_value().resize(n, val);
                 break;
+            case storage_kind::typed_array_value:
+                unpack();
+                array_value().resize(n, val);
+                break;
             default:
                 break;
         }
@@ -3828,6 +4502,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
             {
                 switch (tag())
                 {
@@ -3888,6 +4563,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
             {
                 auto result = jsoncons::detail::to_integer<IntegerType>(as_string_view().data(), as_string_view().length());
                 if (!result)
@@ -3938,6 +4614,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
             {
                 auto result = jsoncons::detail::to_integer<IntegerType>(as_string_view().data(), as_string_view().length());
                 return result ? true : false;
@@ -3978,6 +4655,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
             {
                 auto result = jsoncons::detail::to_integer<IntegerType>(as_string_view().data(), as_string_view().length());
                 return result ? true : false;
@@ -4004,6 +4682,13 @@ public:
                 // to_double() throws std::invalid_argument if conversion fails
                 return to_double(as_cstring(), as_string_view().length());
             }
+            case storage_kind::borrowed_string_value:
+            {
+                // A borrowed string is not null terminated
+                std::basic_string<char_type> s(as_string_view().data(), as_string_view().length());
+                jsoncons::detail::to_double_t to_double;
+                return to_double(s.c_str(), s.length());
+            }
             case storage_kind::half_value:
                 return jsoncons::detail::decode_half(cast<half_storage>().value());
             case storage_kind::double_value:
@@ -4036,6 +4721,7 @@ public:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
             {
                 return string_type(as_string_view().data(),as_string_view().length(),alloc);
             }
@@ -4069,6 +4755,82 @@ public:
         }
     }
 
+    // A view of the elements of a typed array, half precision elements are viewed as uint16_t
+    template <class T>
+    jsoncons::span<const T> as_span() const
+    {
+        switch (storage())
+        {
+            case storage_kind::typed_array_value:
+                check_typed_element_type<T>();
+                return jsoncons::span<const T>(cast<typed_array_storage>().template data<T>(), cast<typed_array_storage>().size());
+            case storage_kind::json_const_pointer:
+                return cast<json_const_pointer_storage>().value()->template as_span<T>();
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a typed array"));
+        }
+    }
+
+    template <class T>
+    jsoncons::span<T> as_span()
+    {
+        switch (storage())
+        {
+            case storage_kind::typed_array_value:
+                check_typed_element_type<T>();
+                return jsoncons::span<T>(cast<typed_array_storage>().template data<T>(), cast<typed_array_storage>().size());
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a typed array"));
+        }
+    }
+
+    // Element i of a typed array as a basic_json value
+    basic_json typed_element(std::size_t i) const
+    {
+        switch (storage())
+        {
+            case storage_kind::typed_array_value:
+            {
+                const auto& stor = cast<typed_array_storage>();
+                if (i >= stor.size())
+                {
+                    JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+                }
+                switch (stor.type())
+                {
+                    case typed_array_type::uint8_value:
+                        return basic_json(static_cast<uint64_t>(stor.template data<uint8_t>()[i]), semantic_tag::none);
+                    case typed_array_type::uint16_value:
+                        return basic_json(static_cast<uint64_t>(stor.template data<uint16_t>()[i]), semantic_tag::none);
+                    case typed_array_type::uint32_value:
+                        return basic_json(static_cast<uint64_t>(stor.template data<uint32_t>()[i]), semantic_tag::none);
+                    case typed_array_type::uint64_value:
+                        return basic_json(stor.template data<uint64_t>()[i], semantic_tag::none);
+                    case typed_array_type::int8_value:
+                        return basic_json(static_cast<int64_t>(stor.template data<int8_t>()[i]), semantic_tag::none);
+                    case typed_array_type::int16_value:
+                        return basic_json(static_cast<int64_t>(stor.template data<int16_t>()[i]), semantic_tag::none);
+                    case typed_array_type::int32_value:
+                        return basic_json(static_cast<int64_t>(stor.template data<int32_t>()[i]), semantic_tag::none);
+                    case typed_array_type::int64_value:
+                        return basic_json(stor.template data<int64_t>()[i], semantic_tag::none);
+                    case typed_array_type::half_value:
+                        return basic_json(half_arg, stor.template data<uint16_t>()[i]);
+                    case typed_array_type::float_value:
+                        return basic_json(static_cast<double>(stor.template data<float>()[i]), semantic_tag::none);
+                    case typed_array_type::double_value:
+                        return basic_json(stor.template data<double>()[i], semantic_tag::none);
+                    default:
+                        JSONCONS_UNREACHABLE();
+                }
+            }
+            case storage_kind::json_const_pointer:
+                return cast<json_const_pointer_storage>().value()->typed_element(i);
+            default:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a typed array"));
+        }
+    }
+
     const char_type* as_cstring() const
     {
         switch (storage())
@@ -4077,6 +4839,8 @@ public:
                 return cast<short_string_storage>().c_str();
             case storage_kind::long_string_value:
                 return cast<long_string_storage>().c_str();
+            case storage_kind::borrowed_string_value:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Borrowed string is not null terminated, use as_string_view or materialize"));
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->as_cstring();
             default:
@@ -4140,6 +4904,9 @@ public:
                     JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
                 }
                 return array_value().operator[](i);
+            case storage_kind::typed_array_value:
+                unpack();
+                return at(i);
             case storage_kind::object_value:
                 return object_value().at(i);
             default:
@@ -4157,6 +4924,8 @@ public:
                     JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
                 }
                 return array_value().operator[](i);
+            case storage_kind::typed_array_value:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Typed array elements are not held as basic_json values, use typed_element or unpack"));
             case storage_kind::object_value:
                 return object_value().at(i);
             case storage_kind::json_const_pointer:
@@ -4265,10 +5034,75 @@ public:
 
     // Modifiers
 
+    // Replaces borrowed strings in this value and its nested values with strings that own their characters.
+    // Nested strings are allocated with the allocator of their enclosing array or object.
+    void materialize()
+    {
+        materialize(get_allocator());
+    }
+
+    void materialize(const Allocator& alloc)
+    {
+        switch (storage())
+        {
+            case storage_kind::borrowed_string_value:
+            {
+                string_view_type sv = as_string_view();
+                *this = basic_json(sv.data(), sv.length(), tag(), alloc);
+                break;
+            }
+            case storage_kind::array_value:
+            {
+                auto item_alloc = get_allocator();
+                for (auto& item : array_value())
+                {
+                    item.materialize(item_alloc);
+                }
+                break;
+            }
+            case storage_kind::object_value:
+            {
+                auto item_alloc = get_allocator();
+                for (auto& member : object_value())
+                {
+                    member.value().materialize(item_alloc);
+                }
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
+    // Replaces a typed array with an array of basic_json values
+    void unpack()
+    {
+        if (storage() == storage_kind::typed_array_value)
+        {
+            basic_json result(json_array_arg, tag(), get_allocator());
+            result.array_value().reserve(size());
+            for (std::size_t i = 0; i < size(); ++i)
+            {
+                result.array_value().push_back(typed_element(i));
+            }
+            swap(result);
+        }
+    }
+
+    // Releases unused capacity in this value and its nested values, and moves
+    // long strings that fit into short string storage
     void shrink_to_fit()
     {
         switch (storage())
         {
+        case storage_kind::long_string_value:
+            if (cast<long_string_storage>().length() <= short_string_storage::max_length)
+            {
+                const auto& s = cast<long_string_storage>();
+                basic_json val(s.data(), s.length(), tag());
+                swap(val);
+            }
+            break;
         case storage_kind::array_value:
             array_value().shrink_to_fit();
             break;
@@ -4287,6 +5121,9 @@ public:
         case storage_kind::array_value:
             array_value().clear();
             break;
+        case storage_kind::typed_array_value:
+            *this = basic_json(json_array_arg, tag(), get_allocator());
+            break;
         case storage_kind::object_value:
             object_value().clear();
             break;
@@ -4666,6 +5503,9 @@ public:
         {
         case storage_kind::array_value:
             return array_value().emplace_back(std::forward<Args>(args)...);
+        case storage_kind::typed_array_value:
+            unpack();
+            return array_value().emplace_back(std::forward<Args>(args)...);
         default:
             {
                 JSONCONS_THROW(json_runtime_error<std::domain_error>("Attempting to insert into a value that is not an array"));
@@ -4686,6 +5526,10 @@ public:
         case storage_kind::array_value:
             array_value().push_back(std::forward<T>(val));
             break;
+        case storage_kind::typed_array_value:
+            unpack();
+            array_value().push_back(std::forward<T>(val));
+            break;
         default:
             {
                 JSONCONS_THROW(json_runtime_error<std::domain_error>("Attempting to insert into a value that is not an array"));
@@ -5232,6 +6076,10 @@ public:
         case storage_kind::array_value:
             array_value().remove_range(from_index, to_index);
             break;
+        case storage_kind::typed_array_value:
+            unpack();
+            array_value().remove_range(from_index, to_index);
+            break;
         default:
             break;
         }
@@ -5328,6 +6176,9 @@ public:
         {
             case storage_kind::array_value:
                 return range<array_iterator, const_array_iterator>(array_value().begin(),array_value().end());
+            case storage_kind::typed_array_value:
+                unpack();
+                return range<array_iterator, const_array_iterator>(array_value().begin(),array_value().end());
             default:
                 JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
         }
@@ -5339,6 +6190,8 @@ public:
         {
             case storage_kind::array_value:
                 return range<const_array_iterator, const_array_iterator>(array_value().begin(),array_value().end());
+            case storage_kind::typed_array_value:
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Typed array elements are not held as basic_json values, use typed_element or unpack"));
             case storage_kind::json_const_pointer:
                 return cast<json_const_pointer_storage>().value()->array_range();
             default:
@@ -5350,6 +6203,9 @@ public:
     {
         switch (storage())
         {
+        case storage_kind::typed_array_value:
+            unpack();
+            JSONCONS_FALLTHROUGH;
         case storage_kind::array_value:
             return cast<array_storage>().value();
         default:
@@ -5406,6 +6262,65 @@ public:
 
 private:
 
+    template <class T>
+    void check_typed_element_type() const
+    {
+        using value_type = typename std::remove_const<T>::type;
+        typed_array_type type = cast<typed_array_storage>().type();
+        if (!(type == jsoncons::detail::typed_array_type_of<value_type>::value ||
+              (type == typed_array_type::half_value && std::is_same<value_type,uint16_t>::value)))
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Typed array element type mismatch"));
+        }
+    }
+
+    template <class T>
+    jsoncons::span<const T> typed_data() const
+    {
+        const auto& stor = cast<typed_array_storage>();
+        return jsoncons::span<const T>(stor.template data<T>(), stor.size());
+    }
+
+    void dump_typed_array(basic_json_visitor<char_type>& visitor, const ser_context& context, std::error_code& ec) const
+    {
+        switch (cast<typed_array_storage>().type())
+        {
+            case typed_array_type::uint8_value:
+                visitor.typed_array(typed_data<uint8_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::uint16_value:
+                visitor.typed_array(typed_data<uint16_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::uint32_value:
+                visitor.typed_array(typed_data<uint32_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::uint64_value:
+                visitor.typed_array(typed_data<uint64_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::int8_value:
+                visitor.typed_array(typed_data<int8_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::int16_value:
+                visitor.typed_array(typed_data<int16_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::int32_value:
+                visitor.typed_array(typed_data<int32_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::int64_value:
+                visitor.typed_array(typed_data<int64_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::half_value:
+                visitor.typed_array(half_arg, typed_data<uint16_t>(), tag(), context, ec);
+                break;
+            case typed_array_type::float_value:
+                visitor.typed_array(typed_data<float>(), tag(), context, ec);
+                break;
+            case typed_array_type::double_value:
+                visitor.typed_array(typed_data<double>(), tag(), context, ec);
+                break;
+        }
+    }
+
     void dump_noflush(basic_json_visitor<char_type>& visitor, std::error_code& ec) const
     {
         const ser_context context{};
@@ -5413,6 +6328,7 @@ private:
         {
             case storage_kind::short_string_value:
             case storage_kind::long_string_value:
+            case storage_kind::borrowed_string_value:
                 visitor.string_value(as_string_view(), tag(), context, ec);
                 break;
             case storage_kind::byte_string_value:
@@ -5463,6 +6379,9 @@ private:
                 }
                 break;
             }
+            case storage_kind::typed_array_value:
+                dump_typed_array(visitor, context, ec);
+                break;
             case storage_kind::array_value:
             {
                 bool more = visitor.begin_array(size(), tag(), context, ec);
@@ -5505,6 +6424,13 @@ private:
     }
 
     friend basic_json deep_copy(const basic_json& other)
+    {
+        return deep_copy_(other, other.get_allocator());
+    }
+
+private:
+    // Borrowed strings are copied with alloc, the allocator of the enclosing array or object
+    static basic_json deep_copy_(const basic_json& other, const Allocator& alloc)
     {
         switch (other.storage())
         {
@@ -5515,7 +6441,7 @@ private:
 
                 for (const auto& item : other.array_range())
                 {
-                    j.push_back(deep_copy(item));
+                    j.push_back(deep_copy_(item, other.get_allocator()));
                 }
                 return j;
             }
@@ -5526,10 +6452,12 @@ private:
 
                 for (const auto& item : other.object_range())
                 {
-                    j.try_emplace(item.key(), deep_copy(item.value()));
+                    j.try_emplace(item.key(), deep_copy_(item.value(), other.get_allocator()));
                 }
                 return j;
             }
+            case storage_kind::borrowed_string_value:
+                return basic_json(other.as_string_view(), other.tag(), alloc);
             case storage_kind::json_const_pointer:
                 return deep_copy(*(other.cast<json_const_pointer_storage>().value()));
             default:
@@ -5544,6 +6472,12 @@ template <class Json>
 typename std::enable_if<is_basic_json<Json>::value,bool>::type
 operator==(const Json& lhs, const Json& rhs) noexcept
 {
+    std::size_t lhs_hash = lhs.cached_hash();
+    std::size_t rhs_hash = rhs.cached_hash();
+    if (lhs_hash != 0 && rhs_hash != 0 && lhs_hash != rhs_hash)
+    {
+        return false;
+    }
     return lhs.compare(rhs) == 0;
 }
 
@@ -5581,7 +6515,7 @@ template <class Json>
 typename std::enable_if<is_basic_json<Json>::value,bool>::type
 operator!=(const Json& lhs, const Json& rhs) noexcept
 {
-    return lhs.compare(rhs) != 0;
+    return !(lhs == rhs);
 }
 
 template <class Json, class T>
@@ -5812,4 +6746,17 @@ jsoncons::wojson operator "" _ojson(const wchar_t* s, std::size_t n)
 
 } // namespace jsoncons
 
+namespace std {
+
+    template <class CharT, class ImplementationPolicy, class Allocator>
+    struct hash<jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>>
+    {
+        std::size_t operator()(const jsoncons::basic_json<CharT,ImplementationPolicy,Allocator>& val) const noexcept
+        {
+            return val.hash();
+        }
+    };
+
+} // namespace std
+
 #endif
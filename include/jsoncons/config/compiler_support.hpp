@@ -182,6 +182,14 @@
 #  endif // defined(JSONCONS_HAS_2017)
 #endif // !defined(JSONCONS_HAS_FILESYSTEM)
 
+#if !defined(JSONCONS_HAS_COROUTINES)
+#  if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__has_include)
+#    if __has_include(<coroutine>)
+#      define JSONCONS_HAS_COROUTINES 1
+#    endif // __has_include(<coroutine>)
+#  endif 
+#endif // !defined(JSONCONS_HAS_COROUTINES)
+
 #if (!defined(JSONCONS_NO_EXCEPTIONS))
 // Check if exceptions are disabled.
 #  if defined( __cpp_exceptions) && __cpp_exceptions == 0
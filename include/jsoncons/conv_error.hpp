@@ -107,7 +107,9 @@ namespace jsoncons {
         not_bitset,
         not_base64,
         not_base64url,
-        not_base16
+        not_base16,
+        missing_required_member,
+        not_borrowable
     };
 
     template <class InputIt>
@@ -193,6 +195,10 @@ namespace detail {
                     return "Input is not a base64url encoded string";
                 case conv_errc::not_base16:
                     return "Input is not a base16 encoded string";
+                case conv_errc::missing_required_member:
+                    return "A required member is missing";
+                case conv_errc::not_borrowable:
+                    return "Cannot borrow a string view from the source";
                 default:
                     return "Unknown conversion error";
             }
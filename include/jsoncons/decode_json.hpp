@@ -28,6 +28,11 @@ namespace jsoncons {
         using char_type = typename Source::value_type;
 
         jsoncons::json_decoder<T> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
+        if (options.borrow_strings())
+        {
+            decoder.borrow_strings_from(jsoncons::basic_string_view<char_type>(s.data(), s.size()));
+        }
         basic_json_reader<char_type, string_source<char_type>> reader(s, decoder, options);
         reader.read();
         if (!decoder.is_valid())
@@ -37,16 +42,67 @@ namespace jsoncons {
         return decoder.get_result();
     }
 
+    // Strings cannot be borrowed from a temporary that owns its characters, they are copied
+    template <class T, class Source>
+    typename std::enable_if<is_basic_json<T>::value &&
+                            jsoncons::detail::is_sequence_of<Source,typename T::char_type>::value &&
+                            !std::is_lvalue_reference<Source>::value &&
+                            !jsoncons::detail::is_basic_string_view<Source>::value,T>::type
+    decode_json(Source&& s,
+                const basic_json_decode_options<typename Source::value_type>& options = basic_json_decode_options<typename Source::value_type>())
+    {
+        using char_type = typename Source::value_type;
+
+        jsoncons::json_decoder<T> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
+        basic_json_reader<char_type, string_source<char_type>> reader(s, decoder, options);
+        reader.read();
+        if (!decoder.is_valid())
+        {
+            JSONCONS_THROW(ser_error(conv_errc::conversion_failed, reader.line(), reader.column()));
+        }
+        return decoder.get_result();
+    }
+
+    template <class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_char_sequence<Source>::value,T>::type
+    decode_json(const Source& s,
+                const basic_json_decode_options<typename Source::value_type>& options = basic_json_decode_options<typename Source::value_type>())
+    {
+        using char_type = typename Source::value_type;
+
+        basic_json_cursor<char_type,string_source<char_type>> cursor(s, options, default_json_parsing());
+        jsoncons::json_decoder<basic_json<char_type>> decoder;
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::basic_string_view<char_type>(s.data(), s.size()));
+        }
+        std::error_code ec;
+        T val = decode_traits<T,char_type>::decode(cursor, decoder, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+        return val;
+    }
+
+    // String views that cannot reference s, for example strings with escapes, are copied into arena
     template <class T, class Source>
     typename std::enable_if<!is_basic_json<T>::value &&
                             jsoncons::detail::is_char_sequence<Source>::value,T>::type
     decode_json(const Source& s,
+                basic_string_arena<typename Source::value_type>& arena,
                 const basic_json_decode_options<typename Source::value_type>& options = basic_json_decode_options<typename Source::value_type>())
     {
         using char_type = typename Source::value_type;
 
         basic_json_cursor<char_type,string_source<char_type>> cursor(s, options, default_json_parsing());
         jsoncons::json_decoder<basic_json<char_type>> decoder;
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::basic_string_view<char_type>(s.data(), s.size()), &arena);
+        }
         std::error_code ec;
         T val = decode_traits<T,char_type>::decode(cursor, decoder, ec);
         if (ec)
@@ -62,6 +118,7 @@ namespace jsoncons {
                 const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>())
     {
         jsoncons::json_decoder<T> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         basic_json_reader<CharT, stream_source<CharT>> reader(is, decoder, options);
         reader.read();
         if (!decoder.is_valid())
@@ -97,6 +154,7 @@ namespace jsoncons {
         using char_type = typename std::iterator_traits<InputIt>::value_type;
 
         jsoncons::json_decoder<T> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         basic_json_reader<char_type, iterator_source<InputIt>> reader(iterator_source<InputIt>(first,last), decoder, options);
         reader.read();
         if (!decoder.is_valid())
@@ -125,6 +183,64 @@ namespace jsoncons {
         return val;
     }
 
+    // decode_json_into, decodes into an existing value and reuses its storage
+
+    template <class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_char_sequence<Source>::value>::type
+    decode_json_into(const Source& s, T& val,
+                     const basic_json_decode_options<typename Source::value_type>& options = basic_json_decode_options<typename Source::value_type>())
+    {
+        using char_type = typename Source::value_type;
+
+        basic_json_cursor<char_type,string_source<char_type>> cursor(s, options, default_json_parsing());
+        jsoncons::json_decoder<basic_json<char_type>> decoder;
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::basic_string_view<char_type>(s.data(), s.size()));
+        }
+        std::error_code ec;
+        decode_into_traits<T,char_type>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template <class T, class CharT>
+    typename std::enable_if<!is_basic_json<T>::value>::type
+    decode_json_into(std::basic_istream<CharT>& is, T& val,
+                     const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>())
+    {
+        basic_json_cursor<CharT> cursor(is, options, default_json_parsing());
+        json_decoder<basic_json<CharT>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,CharT>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.line(), cursor.column()));
+        }
+    }
+
+    template <class T, class InputIt>
+    typename std::enable_if<!is_basic_json<T>::value>::type
+    decode_json_into(InputIt first, InputIt last, T& val,
+                     const basic_json_decode_options<typename std::iterator_traits<InputIt>::value_type>& options = 
+                         basic_json_decode_options<typename std::iterator_traits<InputIt>::value_type>())
+    {
+        using char_type = typename std::iterator_traits<InputIt>::value_type;
+
+        basic_json_cursor<char_type,iterator_source<InputIt>> cursor(iterator_source<InputIt>(first, last), options, default_json_parsing());
+        jsoncons::json_decoder<basic_json<char_type>> decoder;
+        std::error_code ec;
+        decode_into_traits<T,char_type>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.line(), cursor.column()));
+        }
+    }
+
     // With leading allocator parameter
 
     template <class T,class Source,class TempAllocator>
@@ -137,6 +253,7 @@ namespace jsoncons {
         using char_type = typename Source::value_type;
 
         json_decoder<T,TempAllocator> decoder(temp_alloc);
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
 
         basic_json_reader<char_type, string_source<char_type>,TempAllocator> reader(s, decoder, options, temp_alloc);
         reader.read();
@@ -175,6 +292,7 @@ namespace jsoncons {
                 const basic_json_decode_options<CharT>& options = basic_json_decode_options<CharT>())
     {
         json_decoder<T,TempAllocator> decoder(temp_alloc);
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
 
         basic_json_reader<CharT, stream_source<CharT>,TempAllocator> reader(is, decoder, options, temp_alloc);
         reader.read();
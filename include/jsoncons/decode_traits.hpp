@@ -78,6 +78,39 @@ namespace jsoncons {
         }
     };
 
+    // string view, which references the source or the decoder's arena, see json_decoder::borrow_views_from
+
+    template <class T, class CharT>
+    struct decode_traits<T,CharT,
+        typename std::enable_if<detail::is_basic_string_view<T>::value &&
+                                std::is_same<typename T::value_type,CharT>::value
+    >::type>
+    {
+        template <class Json,class TempAllocator>
+        static T decode(basic_staj_cursor<CharT>& cursor, 
+                        json_decoder<Json,TempAllocator>& decoder, 
+                        std::error_code& ec)
+        {
+            if (cursor.current().event_type() != staj_event_type::string_value)
+            {
+                ec = conv_errc::not_string_view;
+                return T();
+            }
+            auto sv = cursor.current().template get<basic_string_view<CharT>>(ec);
+            if (ec)
+            {
+                return T();
+            }
+            basic_string_view<CharT> result;
+            if (!decoder.borrow_view(sv, result))
+            {
+                ec = conv_errc::not_borrowable;
+                return T();
+            }
+            return T(result.data(), result.size());
+        }
+    };
+
     template <class T, class CharT>
     struct decode_traits<T,CharT,
         typename std::enable_if<detail::is_basic_string<T>::value &&
@@ -143,6 +176,26 @@ namespace jsoncons {
         }
     };
 
+    // jsoncons::optional
+
+    template <class T, class CharT>
+    struct decode_traits<jsoncons::optional<T>,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<jsoncons::optional<T>>::value
+    >::type>
+    {
+        template <class Json,class TempAllocator>
+        static jsoncons::optional<T> decode(basic_staj_cursor<CharT>& cursor, 
+                                            json_decoder<Json,TempAllocator>& decoder, 
+                                            std::error_code& ec)
+        {
+            if (cursor.current().event_type() == staj_event_type::null_value)
+            {
+                return jsoncons::optional<T>();
+            }
+            return jsoncons::optional<T>(decode_traits<T,CharT>::decode(cursor, decoder, ec));
+        }
+    };
+
     // vector like
     template <class T, class CharT>
     struct decode_traits<T,CharT,
@@ -283,7 +336,7 @@ namespace jsoncons {
                             const ser_context&,
                             std::error_code&) override
         {
-            v_ = std::vector<value_type>(data.begin(),data.end());
+            v_.assign(data.begin(),data.end());
             return false;
         }
     };
@@ -543,6 +596,231 @@ namespace jsoncons {
         }
     };
 
+    // decode_into_traits
+
+    // Decodes into an existing value, reusing the storage it already holds where it can.
+    // Specialize for containers and classes that can be refilled in place.
+    template <class T, class CharT, class Enable = void>
+    struct decode_into_traits
+    {
+        template <class Json,class TempAllocator>
+        static void decode_into(basic_staj_cursor<CharT>& cursor, 
+                                json_decoder<Json,TempAllocator>& decoder, 
+                                T& val,
+                                std::error_code& ec)
+        {
+            val = decode_traits<T,CharT>::decode(cursor, decoder, ec);
+        }
+    };
+
+    // string
+
+    template <class T, class CharT>
+    struct decode_into_traits<T,CharT,
+        typename std::enable_if<detail::is_basic_string<T>::value &&
+                                std::is_same<typename T::value_type,CharT>::value
+    >::type>
+    {
+        template <class Json,class TempAllocator>
+        static void decode_into(basic_staj_cursor<CharT>& cursor, 
+                                json_decoder<Json,TempAllocator>&, 
+                                T& val,
+                                std::error_code& ec)
+        {
+            if (cursor.current().event_type() != staj_event_type::string_value)
+            {
+                val = cursor.current().template get<T>(ec);
+                return;
+            }
+            auto sv = cursor.current().template get<basic_string_view<CharT>>(ec);
+            if (!ec)
+            {
+                val.assign(sv.data(), sv.size());
+            }
+        }
+    };
+
+    // jsoncons::optional
+
+    template <class T, class CharT>
+    struct decode_into_traits<jsoncons::optional<T>,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<jsoncons::optional<T>>::value
+    >::type>
+    {
+        template <class Json,class TempAllocator>
+        static void decode_into(basic_staj_cursor<CharT>& cursor, 
+                                json_decoder<Json,TempAllocator>& decoder, 
+                                jsoncons::optional<T>& val,
+                                std::error_code& ec)
+        {
+            if (cursor.current().event_type() == staj_event_type::null_value)
+            {
+                val.reset();
+            }
+            else if (val.has_value())
+            {
+                decode_into_traits<T,CharT>::decode_into(cursor, decoder, *val, ec);
+            }
+            else
+            {
+                val = decode_traits<T,CharT>::decode(cursor, decoder, ec);
+            }
+        }
+    };
+
+    // vector like, elements that are already there are decoded into
+
+    template <class T, class CharT>
+    struct decode_into_traits<T,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<T>::value && 
+                 jsoncons::detail::is_list_like<T>::value &&
+                 jsoncons::detail::is_back_insertable<T>::value &&
+                 !detail::is_typed_array<T>::value &&
+                 std::is_default_constructible<typename T::value_type>::value &&
+                 std::is_same<typename T::reference,typename T::value_type&>::value
+    >::type>
+    {
+        using value_type = typename T::value_type;
+
+        template <class Json,class TempAllocator>
+        static void decode_into(basic_staj_cursor<CharT>& cursor, 
+                                json_decoder<Json,TempAllocator>& decoder, 
+                                T& val,
+                                std::error_code& ec)
+        {
+            cursor.array_expected(ec);
+            if (ec)
+            {
+                return;
+            }
+            if (cursor.current().event_type() != staj_event_type::begin_array)
+            {
+                ec = conv_errc::not_vector;
+                return;
+            }
+            auto it = val.begin();
+            cursor.next(ec);
+            while (cursor.current().event_type() != staj_event_type::end_array && !ec)
+            {
+                if (it != val.end())
+                {
+                    decode_into_traits<value_type,CharT>::decode_into(cursor, decoder, *it, ec);
+                    ++it;
+                }
+                else
+                {
+                    val.emplace_back();
+                    decode_into_traits<value_type,CharT>::decode_into(cursor, decoder, val.back(), ec);
+                    it = val.end();
+                }
+                cursor.next(ec);
+            }
+            val.erase(it, val.end());
+        }
+    };
+
+    template <class T, class CharT>
+    struct decode_into_traits<T,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<T>::value && 
+                 jsoncons::detail::is_list_like<T>::value &&
+                 jsoncons::detail::is_back_insertable<T>::value &&
+                 jsoncons::detail::is_typed_array<T>::value
+    >::type>
+    {
+        using value_type = typename T::value_type;
+
+        template <class Json,class TempAllocator>
+        static void decode_into(basic_staj_cursor<CharT>& cursor, 
+                                json_decoder<Json,TempAllocator>&, 
+                                T& val,
+                                std::error_code& ec)
+        {
+            cursor.array_expected(ec);
+            if (ec)
+            {
+                return;
+            }
+            switch (cursor.current().event_type())
+            {
+                case staj_event_type::byte_string_value:
+                    decode_bytes(std::integral_constant<bool,jsoncons::detail::is_back_insertable_byte_container<T>::value>(), 
+                                 cursor, val, ec);
+                    break;
+                case staj_event_type::begin_array:
+                {
+                    val.clear();
+                    typed_array_visitor<T> visitor(val);
+                    cursor.read_to(visitor, ec);
+                    break;
+                }
+                default:
+                    ec = conv_errc::not_vector;
+                    break;
+            }
+        }
+    private:
+        static void decode_bytes(std::true_type, basic_staj_cursor<CharT>& cursor, T& val, std::error_code& ec)
+        {
+            auto bytes = cursor.current().template get<byte_string_view>(ec);
+            if (!ec) 
+            {
+                val.clear();
+                for (auto ch : bytes)
+                {
+                    val.push_back(static_cast<value_type>(ch));
+                }
+            }
+        }
+
+        static void decode_bytes(std::false_type, basic_staj_cursor<CharT>&, T&, std::error_code& ec)
+        {
+            ec = conv_errc::not_vector;
+        }
+    };
+
+    // map like, the map is cleared and refilled
+
+    template <class T, class CharT>
+    struct decode_into_traits<T,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<T>::value && 
+                                jsoncons::detail::is_map_like<T>::value &&
+                                jsoncons::detail::is_constructible_from_const_pointer_and_size<typename T::key_type>::value
+    >::type>
+    {
+        using mapped_type = typename T::mapped_type;
+        using key_type = typename T::key_type;
+
+        template <class Json,class TempAllocator>
+        static void decode_into(basic_staj_cursor<CharT>& cursor, 
+                                json_decoder<Json,TempAllocator>& decoder, 
+                                T& val,
+                                std::error_code& ec)
+        {
+            if (cursor.current().event_type() != staj_event_type::begin_object)
+            {
+                ec = conv_errc::not_map;
+                return;
+            }
+            val.clear();
+            cursor.next(ec);
+
+            while (cursor.current().event_type() != staj_event_type::end_object && !ec)
+            {
+                if (cursor.current().event_type() != staj_event_type::key)
+                {
+                    ec = json_errc::expected_key;
+                    return;
+                }
+                auto key = cursor.current().template get<key_type>(ec);
+                if (ec) return;
+                cursor.next(ec);
+                if (ec) return;
+                val.emplace(std::move(key),decode_traits<mapped_type,CharT>::decode(cursor, decoder, ec));
+                cursor.next(ec);
+            }
+        }
+    };
+
 } // jsoncons
 
 #endif
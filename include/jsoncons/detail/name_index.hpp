@@ -0,0 +1,214 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_NAME_INDEX_HPP
+#define JSONCONS_DETAIL_NAME_INDEX_HPP
+
+#include <cstdint>
+#include <string> // std::char_traits
+#include <vector>
+#include <algorithm> // std::sort
+#include <jsoncons/config/compiler_support.hpp>
+
+namespace jsoncons
+{
+namespace detail
+{
+    // A minimal perfect hash over a fixed set of names, built once, that maps a name
+    // to its position in the set with one hash of the name and one comparison.
+    // Names are hashed into buckets, and each bucket is given a displacement that
+    // places all of its names in free slots of the table (hash and displace).
+    // Repeated names map to their first position.
+    template <class CharT>
+    class name_index
+    {
+        std::vector<const CharT*> names_;
+        std::vector<std::size_t> lengths_;
+        std::vector<uint32_t> displacements_;
+        std::vector<uint32_t> slots_; // position + 1, or 0 if free
+        std::size_t mask_;
+        bool linear_;
+    public:
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+        name_index(const CharT* const* names, std::size_t count)
+            : names_(names, names+count), lengths_(count), mask_(0), linear_(false)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                lengths_[i] = std::char_traits<CharT>::length(names[i]);
+            }
+            std::size_t table_size = 1;
+            while (table_size < 2*count)
+            {
+                table_size *= 2;
+            }
+            while (!build(table_size))
+            {
+                table_size *= 2;
+                // Only names whose hashes collide fully get here
+                if (table_size > 64*(count+1))
+                {
+                    linear_ = true;
+                    break;
+                }
+            }
+        }
+
+        explicit name_index(const std::vector<const CharT*>& names)
+            : name_index(names.data(), names.size())
+        {
+        }
+
+        std::size_t size() const
+        {
+            return names_.size();
+        }
+
+        // Returns the position of the name, or npos if it isn't in the set
+        std::size_t find(const CharT* s, std::size_t length) const
+        {
+            if (names_.empty())
+            {
+                return npos;
+            }
+            if (linear_)
+            {
+                for (std::size_t i = 0; i < names_.size(); ++i)
+                {
+                    if (lengths_[i] == length && std::char_traits<CharT>::compare(names_[i], s, length) == 0)
+                    {
+                        return i;
+                    }
+                }
+                return npos;
+            }
+            uint64_t h = hash(s, length);
+            uint32_t slot = slots_[place(h, displacements_[bucket(h)])];
+            if (slot == 0)
+            {
+                return npos;
+            }
+            std::size_t index = slot - 1;
+            return lengths_[index] == length && std::char_traits<CharT>::compare(names_[index], s, length) == 0 ? index : npos;
+        }
+
+    private:
+        static uint64_t hash(const CharT* s, std::size_t length)
+        {
+            uint64_t h = 14695981039346656037ull;
+            for (std::size_t i = 0; i < length; ++i)
+            {
+                h ^= static_cast<uint64_t>(s[i]);
+                h *= 1099511628211ull;
+            }
+            return h;
+        }
+
+        static uint64_t mix(uint64_t x)
+        {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        std::size_t bucket(uint64_t h) const
+        {
+            return static_cast<std::size_t>((h >> 32) % displacements_.size());
+        }
+
+        std::size_t place(uint64_t h, uint32_t displacement) const
+        {
+            return static_cast<std::size_t>(mix(h + displacement*0x9e3779b97f4a7c15ull)) & mask_;
+        }
+
+        bool build(std::size_t table_size)
+        {
+            const std::size_t count = names_.size();
+            mask_ = table_size - 1;
+            slots_.assign(table_size, 0);
+            displacements_.assign(count == 0 ? 1 : count, 0);
+
+            std::vector<uint64_t> hashes(count);
+            std::vector<std::vector<std::size_t>> buckets(displacements_.size());
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                bool repeated = false;
+                for (std::size_t j = 0; j < i && !repeated; ++j)
+                {
+                    repeated = lengths_[j] == lengths_[i] && std::char_traits<CharT>::compare(names_[j], names_[i], lengths_[i]) == 0;
+                }
+                if (!repeated)
+                {
+                    hashes[i] = hash(names_[i], lengths_[i]);
+                    buckets[bucket(hashes[i])].push_back(i);
+                }
+            }
+
+            // Place the fullest buckets first, while there are the most free slots
+            std::vector<std::size_t> order(buckets.size());
+            for (std::size_t b = 0; b < order.size(); ++b)
+            {
+                order[b] = b;
+            }
+            std::sort(order.begin(), order.end(),
+                      [&buckets](std::size_t a, std::size_t b) {return buckets[a].size() > buckets[b].size();});
+
+            std::vector<std::size_t> placed;
+            for (std::size_t b : order)
+            {
+                const std::vector<std::size_t>& members = buckets[b];
+                if (members.empty())
+                {
+                    break;
+                }
+                bool done = false;
+                for (uint32_t d = 0; d < 4096 && !done; ++d)
+                {
+                    placed.clear();
+                    done = true;
+                    for (std::size_t i : members)
+                    {
+                        std::size_t slot = place(hashes[i], d);
+                        if (slots_[slot] != 0)
+                        {
+                            done = false;
+                            break;
+                        }
+                        slots_[slot] = static_cast<uint32_t>(i + 1);
+                        placed.push_back(slot);
+                    }
+                    if (!done)
+                    {
+                        for (std::size_t slot : placed)
+                        {
+                            slots_[slot] = 0;
+                        }
+                    }
+                    else
+                    {
+                        displacements_[b] = d;
+                    }
+                }
+                if (!done)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    template <class CharT>
+    constexpr std::size_t name_index<CharT>::npos;
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
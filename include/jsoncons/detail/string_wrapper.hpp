@@ -156,6 +156,12 @@ namespace detail {
         {
             return ptr_->get_allocator();
         }
+
+        // Number of bytes allocated for the string
+        std::size_t allocated_size() const
+        {
+            return aligned_size(ptr_->length_*sizeof(char_type));
+        }
     private:
         static size_t aligned_size(std::size_t n)
         {
@@ -326,6 +332,12 @@ namespace detail {
         {
             return ptr_->get_allocator();
         }
+
+        // Number of bytes allocated for the string
+        std::size_t allocated_size() const
+        {
+            return aligned_size(ptr_->length_*sizeof(char_type));
+        }
     private:
         static size_t aligned_size(std::size_t n)
         {
@@ -0,0 +1,199 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_DETAIL_TYPED_ARRAY_WRAPPER_HPP
+#define JSONCONS_DETAIL_TYPED_ARRAY_WRAPPER_HPP
+
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <memory> // std::allocator
+#include <utility> // std::swap
+#include <jsoncons/config/compiler_support.hpp>
+#include <jsoncons/detail/string_wrapper.hpp>
+
+namespace jsoncons {
+namespace detail {
+
+    // typed_array_wrapper
+
+    // Holds the elements of a packed numeric array in a single allocation,
+    // the element type is kept by the owner
+    template <class Allocator>
+    class typed_array_wrapper
+    {
+    private:
+        struct arr_base_t
+        {
+            Allocator alloc_;
+
+            Allocator& get_allocator()
+            {
+                return alloc_;
+            }
+
+            const Allocator& get_allocator() const
+            {
+                return alloc_;
+            }
+
+            arr_base_t(const Allocator& alloc)
+                : alloc_(alloc)
+            {
+            }
+
+            ~arr_base_t() noexcept = default;
+        };
+
+        struct arr_t : public arr_base_t
+        {
+            void* p_;
+            std::size_t size_;
+            std::size_t bytes_;
+
+            ~arr_t() noexcept = default;
+
+            arr_t(const Allocator& alloc)
+                : arr_base_t(alloc), p_(nullptr), size_(0), bytes_(0)
+            {
+            }
+
+            arr_t(const arr_t&) = delete;
+            arr_t& operator=(const arr_t&) = delete;
+        };
+
+        union element_t
+        {
+            uint64_t u;
+            double d;
+        };
+
+        typedef typename std::allocator_traits<Allocator>::template rebind_alloc<char> byte_allocator_type;
+        using byte_pointer = typename std::allocator_traits<byte_allocator_type>::pointer;
+
+        typedef typename std::allocator_traits<Allocator>::template rebind_alloc<arr_t> array_allocator_type;
+        using array_pointer = typename std::allocator_traits<array_allocator_type>::pointer;
+
+        struct storage_t
+        {
+            arr_t data;
+            element_t e[1];
+        };
+        typedef typename std::aligned_storage<sizeof(storage_t), alignof(storage_t)>::type storage_kind;
+
+        array_pointer ptr_;
+    public:
+        typed_array_wrapper() = default;
+
+        typed_array_wrapper(array_pointer ptr)
+            : ptr_(ptr)
+        {
+        }
+
+        template <class T>
+        typed_array_wrapper(const T* data, std::size_t size, const Allocator& a)
+        {
+            ptr_ = create(data, size, a);
+        }
+
+        typed_array_wrapper(const typed_array_wrapper& val)
+        {
+            ptr_ = create(static_cast<const uint8_t*>(val.ptr_->p_), val.ptr_->bytes_, val.get_allocator());
+            ptr_->size_ = val.size();
+        }
+
+        typed_array_wrapper(const typed_array_wrapper& val, const Allocator& a)
+        {
+            ptr_ = create(static_cast<const uint8_t*>(val.ptr_->p_), val.ptr_->bytes_, a);
+            ptr_->size_ = val.size();
+        }
+
+        ~typed_array_wrapper() noexcept
+        {
+            if (ptr_ != nullptr)
+            {
+                destroy(ptr_);
+            }
+        }
+
+        void swap(typed_array_wrapper& other) noexcept
+        {
+            std::swap(ptr_,other.ptr_);
+        }
+
+        template <class T>
+        const T* data() const
+        {
+            return static_cast<const T*>(ptr_->p_);
+        }
+
+        template <class T>
+        T* data()
+        {
+            return static_cast<T*>(ptr_->p_);
+        }
+
+        std::size_t size() const
+        {
+            return ptr_->size_;
+        }
+
+        Allocator get_allocator() const
+        {
+            return ptr_->get_allocator();
+        }
+
+        // Number of bytes allocated for the elements
+        std::size_t allocated_size() const
+        {
+            return aligned_size(ptr_->bytes_);
+        }
+
+    private:
+        static size_t aligned_size(std::size_t n)
+        {
+            return sizeof(storage_kind) + n;
+        }
+
+        template <class T>
+        static array_pointer create(const T* data, std::size_t size, const Allocator& alloc)
+        {
+            std::size_t bytes = size*sizeof(T);
+            std::size_t mem_size = aligned_size(bytes);
+            byte_allocator_type byte_alloc(alloc);
+            byte_pointer ptr = byte_alloc.allocate(mem_size);
+
+            char* storage = to_plain_pointer(ptr);
+            arr_t* ps = new(storage)arr_t(byte_alloc);
+
+            auto psa = launder_cast<storage_t*>(storage);
+
+            T* p = new(&psa->e)T[size == 0 ? 1 : size];
+            if (size > 0)
+            {
+                std::memcpy(p, data, bytes);
+            }
+            ps->p_ = p;
+            ps->size_ = size;
+            ps->bytes_ = bytes;
+            return std::pointer_traits<array_pointer>::pointer_to(*ps);
+        }
+
+        static void destroy(array_pointer ptr)
+        {
+            arr_t* rawp = to_plain_pointer(ptr);
+
+            char* p = launder_cast<char*>(rawp);
+
+            std::size_t mem_size = aligned_size(ptr->bytes_);
+            byte_allocator_type byte_alloc(ptr->get_allocator());
+            byte_alloc.deallocate(p,mem_size);
+        }
+    };
+
+} // namespace detail
+} // namespace jsoncons
+
+#endif
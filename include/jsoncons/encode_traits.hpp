@@ -238,6 +238,76 @@ namespace jsoncons {
         }
     };
 
+    // std::shared_ptr, std::unique_ptr, jsoncons::optional
+
+    template <class T, class CharT>
+    struct encode_traits<std::shared_ptr<T>,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<std::shared_ptr<T>>::value &&
+                                !std::is_polymorphic<T>::value
+    >::type>
+    {
+        template <class Json>
+        static void encode(const std::shared_ptr<T>& val, 
+                           basic_json_visitor<CharT>& encoder, 
+                           const Json& proto, 
+                           std::error_code& ec)
+        {
+            if (val.get() != nullptr)
+            {
+                encode_traits<T,CharT>::encode(*val, encoder, proto, ec);
+            }
+            else
+            {
+                encoder.null_value(semantic_tag::none,ser_context(),ec);
+            }
+        }
+    };
+
+    template <class T, class CharT>
+    struct encode_traits<std::unique_ptr<T>,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<std::unique_ptr<T>>::value &&
+                                !std::is_polymorphic<T>::value
+    >::type>
+    {
+        template <class Json>
+        static void encode(const std::unique_ptr<T>& val, 
+                           basic_json_visitor<CharT>& encoder, 
+                           const Json& proto, 
+                           std::error_code& ec)
+        {
+            if (val.get() != nullptr)
+            {
+                encode_traits<T,CharT>::encode(*val, encoder, proto, ec);
+            }
+            else
+            {
+                encoder.null_value(semantic_tag::none,ser_context(),ec);
+            }
+        }
+    };
+
+    template <class T, class CharT>
+    struct encode_traits<jsoncons::optional<T>,CharT,
+        typename std::enable_if<!is_json_type_traits_declared<jsoncons::optional<T>>::value
+    >::type>
+    {
+        template <class Json>
+        static void encode(const jsoncons::optional<T>& val, 
+                           basic_json_visitor<CharT>& encoder, 
+                           const Json& proto, 
+                           std::error_code& ec)
+        {
+            if (val.has_value())
+            {
+                encode_traits<T,CharT>::encode(*val, encoder, proto, ec);
+            }
+            else
+            {
+                encoder.null_value(semantic_tag::none,ser_context(),ec);
+            }
+        }
+    };
+
     // vector like
     template <class T, class CharT>
     struct encode_traits<T,CharT,
@@ -254,7 +324,8 @@ namespace jsoncons {
                            const Json& proto, 
                            std::error_code& ec)
         {
-            encoder.begin_array(val.size(),semantic_tag::none,ser_context(),ec);
+            encoder.begin_array(size(std::integral_constant<bool, jsoncons::detail::has_size<T>::value>(), val),
+                                semantic_tag::none,ser_context(),ec);
             if (ec) return;
             for (auto it = std::begin(val); it != std::end(val); ++it)
             {
@@ -263,6 +334,16 @@ namespace jsoncons {
             }
             encoder.end_array(ser_context(), ec);
         }
+    private:
+        static std::size_t size(std::true_type, const T& val)
+        {
+            return val.size();
+        }
+        // e.g. std::forward_list
+        static std::size_t size(std::false_type, const T& val)
+        {
+            return static_cast<std::size_t>(std::distance(std::begin(val), std::end(val)));
+        }
     };
 
     template <class T, class CharT>
@@ -0,0 +1,443 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_INTERNED_KEY_HPP
+#define JSONCONS_INTERNED_KEY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstring> // std::memcpy
+#include <iterator> // std::distance
+#include <memory> // std::allocator
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility> // std::swap
+#include <jsoncons/config/jsoncons_config.hpp>
+#include <jsoncons/detail/string_wrapper.hpp>
+
+namespace jsoncons {
+
+    template <class CharT,class CharTraits,class Allocator>
+    class basic_key_intern_table;
+
+    // basic_interned_key
+
+    // An immutable, reference counted key. Keys obtained from the same
+    // basic_key_intern_table share one buffer and compare equal by pointer.
+    template <class CharT,class CharTraits = std::char_traits<CharT>,class Allocator = std::allocator<CharT>>
+    class basic_interned_key
+    {
+        friend class basic_key_intern_table<CharT,CharTraits,Allocator>;
+    public:
+        using value_type = CharT;
+        using traits_type = CharTraits;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using const_iterator = const CharT*;
+        using iterator = const_iterator;
+        using string_view_type = jsoncons::basic_string_view<CharT,CharTraits>;
+    private:
+        struct key_t
+        {
+            std::atomic<std::size_t> refs_;
+            Allocator alloc_;
+            std::size_t length_;
+            CharT* p_;
+
+            key_t(const Allocator& alloc, std::size_t length)
+                : refs_(1), alloc_(alloc), length_(length), p_(nullptr)
+            {
+            }
+        };
+
+        typedef typename std::allocator_traits<Allocator>::template rebind_alloc<char> byte_allocator_type;
+        using byte_pointer = typename std::allocator_traits<byte_allocator_type>::pointer;
+
+        struct storage_t
+        {
+            key_t data;
+            CharT c[1];
+        };
+        typedef typename std::aligned_storage<sizeof(storage_t), alignof(storage_t)>::type storage_kind;
+
+        key_t* ptr_;
+    public:
+        basic_interned_key() noexcept
+            : ptr_(nullptr)
+        {
+        }
+
+        explicit basic_interned_key(const Allocator&) noexcept
+            : ptr_(nullptr)
+        {
+        }
+
+        basic_interned_key(const CharT* s, std::size_t length, const Allocator& alloc = Allocator())
+            : ptr_(create(s, length, alloc))
+        {
+        }
+
+        basic_interned_key(const CharT* s, const Allocator& alloc = Allocator())
+            : ptr_(create(s, CharTraits::length(s), alloc))
+        {
+        }
+
+        template <class InputIt>
+        basic_interned_key(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+            : ptr_(nullptr)
+        {
+            std::basic_string<CharT,CharTraits> s(first, last);
+            ptr_ = create(s.data(), s.length(), alloc);
+        }
+
+        template <class Traits,class Alloc>
+        basic_interned_key(const std::basic_string<CharT,Traits,Alloc>& s, const Allocator& alloc = Allocator())
+            : ptr_(create(s.data(), s.length(), alloc))
+        {
+        }
+
+        basic_interned_key(const basic_interned_key& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            acquire(ptr_);
+        }
+
+        basic_interned_key(const basic_interned_key& other, const Allocator&) noexcept
+            : ptr_(other.ptr_)
+        {
+            acquire(ptr_);
+        }
+
+        basic_interned_key(basic_interned_key&& other) noexcept
+            : ptr_(other.ptr_)
+        {
+            other.ptr_ = nullptr;
+        }
+
+        ~basic_interned_key() noexcept
+        {
+            release(ptr_);
+        }
+
+        basic_interned_key& operator=(const basic_interned_key& other) noexcept
+        {
+            if (this != &other)
+            {
+                acquire(other.ptr_);
+                release(ptr_);
+                ptr_ = other.ptr_;
+            }
+            return *this;
+        }
+
+        basic_interned_key& operator=(basic_interned_key&& other) noexcept
+        {
+            if (this != &other)
+            {
+                std::swap(ptr_, other.ptr_);
+            }
+            return *this;
+        }
+
+        void swap(basic_interned_key& other) noexcept
+        {
+            std::swap(ptr_, other.ptr_);
+        }
+
+        const CharT* data() const noexcept
+        {
+            return ptr_ ? ptr_->p_ : empty_string();
+        }
+
+        const CharT* c_str() const noexcept
+        {
+            return data();
+        }
+
+        std::size_t size() const noexcept
+        {
+            return ptr_ ? ptr_->length_ : 0;
+        }
+
+        std::size_t length() const noexcept
+        {
+            return size();
+        }
+
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data() + size();
+        }
+
+        const CharT& operator[](std::size_t i) const
+        {
+            return data()[i];
+        }
+
+        Allocator get_allocator() const
+        {
+            return ptr_ ? ptr_->alloc_ : Allocator();
+        }
+
+        // Keys are immutable, there is no unused capacity to release
+        void shrink_to_fit() noexcept
+        {
+        }
+
+        // Returns true if this key and other share the same buffer
+        bool same_buffer(const basic_interned_key& other) const noexcept
+        {
+            return ptr_ == other.ptr_;
+        }
+
+        operator string_view_type() const noexcept
+        {
+            return string_view_type(data(), size());
+        }
+
+        template <class Traits,class Alloc>
+        explicit operator std::basic_string<CharT,Traits,Alloc>() const
+        {
+            return std::basic_string<CharT,Traits,Alloc>(data(), size());
+        }
+
+        int compare(const basic_interned_key& other) const noexcept
+        {
+            return ptr_ == other.ptr_ ? 0 : string_view_type(*this).compare(string_view_type(other));
+        }
+
+        int compare(const string_view_type& s) const noexcept
+        {
+            return string_view_type(*this).compare(s);
+        }
+
+        int compare(const CharT* s) const noexcept
+        {
+            return string_view_type(*this).compare(string_view_type(s));
+        }
+
+        template <class Traits,class Alloc>
+        int compare(const std::basic_string<CharT,Traits,Alloc>& s) const noexcept
+        {
+            return string_view_type(*this).compare(string_view_type(s.data(), s.length()));
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.ptr_ == rhs.ptr_ || (lhs.size() == rhs.size() && lhs.compare(rhs) == 0);
+        }
+        friend bool operator!=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        friend bool operator<(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) < 0;
+        }
+        friend bool operator<=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) <= 0;
+        }
+        friend bool operator>(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) > 0;
+        }
+        friend bool operator>=(const basic_interned_key& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return lhs.compare(rhs) >= 0;
+        }
+
+        friend bool operator==(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.compare(rhs) == 0;
+        }
+        friend bool operator==(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) == 0;
+        }
+        friend bool operator!=(const basic_interned_key& lhs, const string_view_type& rhs) noexcept
+        {
+            return lhs.compare(rhs) != 0;
+        }
+        friend bool operator!=(const string_view_type& lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) != 0;
+        }
+        friend bool operator==(const basic_interned_key& lhs, const CharT* rhs) noexcept
+        {
+            return lhs.compare(rhs) == 0;
+        }
+        friend bool operator==(const CharT* lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) == 0;
+        }
+        friend bool operator!=(const basic_interned_key& lhs, const CharT* rhs) noexcept
+        {
+            return lhs.compare(rhs) != 0;
+        }
+        friend bool operator!=(const CharT* lhs, const basic_interned_key& rhs) noexcept
+        {
+            return rhs.compare(lhs) != 0;
+        }
+
+        friend std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, const basic_interned_key& key)
+        {
+            os.write(key.data(), key.size());
+            return os;
+        }
+    private:
+        static const CharT* empty_string() noexcept
+        {
+            static const CharT s[1] = {0};
+            return s;
+        }
+
+        static std::size_t aligned_size(std::size_t n)
+        {
+            return sizeof(storage_kind) + n;
+        }
+
+        static key_t* create(const CharT* s, std::size_t length, const Allocator& alloc)
+        {
+            std::size_t mem_size = aligned_size(length*sizeof(CharT));
+
+            byte_allocator_type byte_alloc(alloc);
+            byte_pointer ptr = byte_alloc.allocate(mem_size);
+
+            char* storage = jsoncons::detail::to_plain_pointer(ptr);
+            key_t* ps = new(storage)key_t(alloc, length);
+
+            auto psa = jsoncons::detail::launder_cast<storage_t*>(storage);
+
+            CharT* p = new(&psa->c)CharT[length + 1];
+            if (length > 0)
+            {
+                std::memcpy(p, s, length*sizeof(CharT));
+            }
+            p[length] = 0;
+            ps->p_ = p;
+            return ps;
+        }
+
+        static void acquire(key_t* ptr) noexcept
+        {
+            if (ptr != nullptr)
+            {
+                ptr->refs_.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        static void release(key_t* ptr) noexcept
+        {
+            if (ptr != nullptr && ptr->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::size_t mem_size = aligned_size(ptr->length_*sizeof(CharT));
+                byte_allocator_type byte_alloc(ptr->alloc_);
+                ptr->~key_t();
+                byte_alloc.deallocate(jsoncons::detail::launder_cast<char*>(ptr), mem_size);
+            }
+        }
+    };
+
+    // basic_key_intern_table
+
+    // Maps key text to interned keys. The table may be shared between decoders
+    // and threads, interned keys remain valid after the table is destroyed.
+    template <class CharT,class CharTraits = std::char_traits<CharT>,class Allocator = std::allocator<CharT>>
+    class basic_key_intern_table
+    {
+    public:
+        using key_type = basic_interned_key<CharT,CharTraits,Allocator>;
+        using string_view_type = jsoncons::basic_string_view<CharT,CharTraits>;
+        using allocator_type = Allocator;
+    private:
+        struct string_view_hash
+        {
+            std::size_t operator()(const string_view_type& s) const noexcept
+            {
+                // FNV-1a
+                std::size_t hash = static_cast<std::size_t>(14695981039346656037ULL);
+                for (auto c : s)
+                {
+                    hash ^= static_cast<std::size_t>(c);
+                    hash *= static_cast<std::size_t>(1099511628211ULL);
+                }
+                return hash;
+            }
+        };
+
+        Allocator alloc_;
+        mutable std::mutex mutex_;
+        std::unordered_map<string_view_type,key_type,string_view_hash> keys_;
+    public:
+        basic_key_intern_table(const Allocator& alloc = Allocator())
+            : alloc_(alloc)
+        {
+        }
+
+        basic_key_intern_table(const basic_key_intern_table&) = delete;
+        basic_key_intern_table& operator=(const basic_key_intern_table&) = delete;
+
+        key_type intern(const string_view_type& s)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            auto it = keys_.find(s);
+            if (it != keys_.end())
+            {
+                return it->second;
+            }
+            key_type key(s.data(), s.size(), alloc_);
+            keys_.emplace(string_view_type(key.data(), key.size()), key);
+            return key;
+        }
+
+        std::size_t size() const
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            return keys_.size();
+        }
+
+        // Releases the table's references, keys already handed out remain valid
+        void clear()
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            keys_.clear();
+        }
+
+        Allocator get_allocator() const
+        {
+            return alloc_;
+        }
+    };
+
+    using key_intern_table = basic_key_intern_table<char>;
+    using wkey_intern_table = basic_key_intern_table<wchar_t>;
+
+namespace detail {
+
+    template <class Key>
+    struct is_interned_key : std::false_type {};
+
+    template <class CharT,class CharTraits,class Allocator>
+    struct is_interned_key<basic_interned_key<CharT,CharTraits,Allocator>> : std::true_type {};
+
+} // namespace detail
+
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,265 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_BUILDER_HPP
+#define JSONCONS_JSON_BUILDER_HPP
+
+#include <algorithm> // std::stable_sort
+#include <iterator> // std::make_move_iterator
+#include <memory> // std::allocator_traits
+#include <type_traits> // std::is_same
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/tag_type.hpp>
+#include <jsoncons/json_container_types.hpp>
+
+namespace jsoncons {
+
+    // Which member is kept when a builder has been given the same name more than once
+    enum class duplicate_key_policy {last_wins, first_wins};
+
+    // basic_object_builder
+
+    // Collects members in any order and builds an object with a single sort,
+    // instead of a sorted insert per member
+    template <class Json>
+    class basic_object_builder
+    {
+    public:
+        using basic_json_type = Json;
+        using allocator_type = typename Json::allocator_type;
+        using string_view_type = typename Json::string_view_type;
+        using key_type = typename Json::key_type;
+        using key_value_type = typename Json::key_value_type;
+    private:
+        using key_allocator_type = typename key_type::allocator_type;
+        using key_value_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<key_value_type>;
+        using index_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<std::size_t>;
+        using preserve_order = std::is_same<typename Json::implementation_policy::key_order,preserve_key_order>;
+
+        allocator_type alloc_;
+        std::vector<key_value_type,key_value_allocator_type> members_;
+    public:
+        explicit basic_object_builder(const allocator_type& alloc = allocator_type())
+            : alloc_(alloc), members_(key_value_allocator_type(alloc))
+        {
+        }
+
+        basic_object_builder(std::size_t capacity, const allocator_type& alloc = allocator_type())
+            : alloc_(alloc), members_(key_value_allocator_type(alloc))
+        {
+            members_.reserve(capacity);
+        }
+
+        basic_object_builder(const basic_object_builder&) = delete;
+        basic_object_builder(basic_object_builder&&) = default;
+        basic_object_builder& operator=(const basic_object_builder&) = delete;
+        basic_object_builder& operator=(basic_object_builder&&) = default;
+
+        void reserve(std::size_t n)
+        {
+            members_.reserve(n);
+        }
+
+        // Returns the number of members added, including duplicates
+        std::size_t size() const noexcept
+        {
+            return members_.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return members_.empty();
+        }
+
+        template <class... Args>
+        void emplace(const string_view_type& name, Args&&... args)
+        {
+            members_.emplace_back(key_type(name.begin(), name.end(), key_allocator_type(alloc_)),
+                                  std::forward<Args>(args)...);
+        }
+
+        template <class T>
+        void insert(const string_view_type& name, T&& value)
+        {
+            emplace(name, std::forward<T>(value));
+        }
+
+        void clear()
+        {
+            members_.clear();
+        }
+
+        // Returns an object with the members added so far, and leaves the builder empty.
+        // Members are in key order, or for preserve order policies, in the order
+        // in which their names were first added.
+        Json build(duplicate_key_policy policy = duplicate_key_policy::last_wins)
+        {
+            Json result(json_object_arg, semantic_tag::none, alloc_);
+            resolve_duplicates(policy, preserve_order());
+            result.insert(sorted_unique_range_tag(),
+                          std::make_move_iterator(members_.begin()),
+                          std::make_move_iterator(members_.end()));
+            members_.clear();
+            return result;
+        }
+
+    private:
+        static bool key_less(const key_value_type& a, const key_value_type& b)
+        {
+            return a.key().compare(b.key()) < 0;
+        }
+
+        // Leaves members_ sorted by key, with one member per key
+        void resolve_duplicates(duplicate_key_policy policy, std::false_type)
+        {
+            std::stable_sort(members_.begin(), members_.end(), key_less);
+
+            auto out = members_.begin();
+            auto first = members_.begin();
+            while (first != members_.end())
+            {
+                auto last = first + 1;
+                while (last != members_.end() && !(last->key().compare(first->key())))
+                {
+                    ++last;
+                }
+                auto winner = policy == duplicate_key_policy::first_wins ? first : last - 1;
+                if (out != winner)
+                {
+                    *out = std::move(*winner);
+                }
+                ++out;
+                first = last;
+            }
+            members_.erase(out, members_.end());
+        }
+
+        // Leaves members_ in the order names were first added, with one member per key
+        void resolve_duplicates(duplicate_key_policy policy, std::true_type)
+        {
+            index_allocator_type index_alloc(alloc_);
+            std::vector<std::size_t,index_allocator_type> index(index_alloc);
+            index.reserve(members_.size());
+            for (std::size_t i = 0; i < members_.size(); ++i)
+            {
+                index.push_back(i);
+            }
+            std::stable_sort(index.begin(), index.end(),
+                             [&](std::size_t a, std::size_t b) -> bool {return key_less(members_[a], members_[b]);});
+
+            std::vector<bool> keep(members_.size(), true);
+            bool has_duplicates = false;
+            auto first = index.begin();
+            while (first != index.end())
+            {
+                auto last = first + 1;
+                while (last != index.end() && !(members_[*last].key().compare(members_[*first].key())))
+                {
+                    keep[*last] = false;
+                    ++last;
+                }
+                if (last - first > 1)
+                {
+                    has_duplicates = true;
+                    if (policy == duplicate_key_policy::last_wins)
+                    {
+                        members_[*first].value() = std::move(members_[*(last - 1)].value());
+                    }
+                }
+                first = last;
+            }
+            if (has_duplicates)
+            {
+                std::size_t out = 0;
+                for (std::size_t i = 0; i < members_.size(); ++i)
+                {
+                    if (keep[i])
+                    {
+                        if (out != i)
+                        {
+                            members_[out] = std::move(members_[i]);
+                        }
+                        ++out;
+                    }
+                }
+                members_.erase(members_.begin() + out, members_.end());
+            }
+        }
+    };
+
+    // basic_array_builder
+
+    // Collects elements with reserved capacity, and builds an array without copying them
+    template <class Json>
+    class basic_array_builder
+    {
+    public:
+        using basic_json_type = Json;
+        using allocator_type = typename Json::allocator_type;
+    private:
+        Json value_;
+    public:
+        explicit basic_array_builder(const allocator_type& alloc = allocator_type())
+            : value_(json_array_arg, semantic_tag::none, alloc)
+        {
+        }
+
+        basic_array_builder(std::size_t capacity, const allocator_type& alloc = allocator_type())
+            : value_(json_array_arg, semantic_tag::none, alloc)
+        {
+            value_.reserve(capacity);
+        }
+
+        basic_array_builder(const basic_array_builder&) = delete;
+        basic_array_builder(basic_array_builder&&) = default;
+        basic_array_builder& operator=(const basic_array_builder&) = delete;
+        basic_array_builder& operator=(basic_array_builder&&) = default;
+
+        void reserve(std::size_t n)
+        {
+            value_.reserve(n);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return value_.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return value_.empty();
+        }
+
+        template <class T>
+        void push_back(T&& value)
+        {
+            value_.push_back(std::forward<T>(value));
+        }
+
+        template <class... Args>
+        void emplace_back(Args&&... args)
+        {
+            value_.emplace_back(std::forward<Args>(args)...);
+        }
+
+        void clear()
+        {
+            value_.clear();
+        }
+
+        // Returns an array with the elements added so far, and leaves the builder empty
+        Json build()
+        {
+            Json result(json_array_arg, semantic_tag::none, value_.get_allocator());
+            result.swap(value_);
+            return result;
+        }
+    };
+
+} // namespace jsoncons
+
+#endif
@@ -11,7 +11,7 @@
 #include <vector>
 #include <exception>
 #include <cstring>
-#include <algorithm> // std::sort, std::stable_sort, std::lower_bound, std::unique
+#include <algorithm> // std::sort, std::stable_sort, std::lower_bound, std::unique, std::adjacent_find
 #include <utility>
 #include <initializer_list>
 #include <iterator> // std::iterator_traits
@@ -19,15 +19,56 @@
 #include <utility> // std::move
 #include <cassert> // assert
 #include <type_traits> // std::enable_if
+#include <atomic> // std::atomic
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/allocator_holder.hpp>
 
 namespace jsoncons {
 
+    // container_hash_cache
+
+    // Holds the hash of an array or object once computed, zero if not computed. 
+    // Copies start without a cached hash.
+    class container_hash_cache
+    {
+        mutable std::atomic<std::size_t> hash_;
+    public:
+        container_hash_cache() noexcept
+            : hash_(0)
+        {
+        }
+
+        container_hash_cache(const container_hash_cache&) noexcept
+            : hash_(0)
+        {
+        }
+
+        container_hash_cache& operator=(const container_hash_cache&) noexcept
+        {
+            invalidate_hash();
+            return *this;
+        }
+
+        std::size_t cached_hash() const noexcept
+        {
+            return hash_.load(std::memory_order_relaxed);
+        }
+
+        void cache_hash(std::size_t value) const noexcept
+        {
+            hash_.store(value, std::memory_order_relaxed);
+        }
+
+        void invalidate_hash() noexcept
+        {
+            hash_.store(0, std::memory_order_relaxed);
+        }
+    };
+
     // json_array
 
     template <class Json>
-    class json_array : public allocator_holder<typename Json::allocator_type>
+    class json_array : public allocator_holder<typename Json::allocator_type>, public container_hash_cache
     {
     public:
         using allocator_type = typename Json::allocator_type;
@@ -78,6 +119,7 @@ namespace jsoncons {
         }
         json_array(const json_array& val)
             : allocator_holder<allocator_type>(val.get_allocator()),
+              container_hash_cache(),
               elements_(val.elements_)
         {
         }
@@ -91,11 +133,15 @@ namespace jsoncons {
             : allocator_holder<allocator_type>(val.get_allocator()), 
               elements_(std::move(val.elements_))
         {
+            cache_hash(val.cached_hash());
+            val.invalidate_hash();
         }
         json_array(json_array&& val, const allocator_type& alloc)
             : allocator_holder<allocator_type>(alloc), 
               elements_(std::move(val.elements_),value_allocator_type(alloc))
         {
+            cache_hash(val.cached_hash());
+            val.invalidate_hash();
         }
 
         json_array(const std::initializer_list<Json>& init, 
@@ -132,6 +178,8 @@ namespace jsoncons {
         void swap(json_array<Json>& val) noexcept
         {
             elements_.swap(val.elements_);
+            invalidate_hash();
+            val.invalidate_hash();
         }
 
         std::size_t size() const {return elements_.size();}
@@ -528,7 +576,7 @@ namespace jsoncons {
     // Sort keys
     template <class KeyT,class Json>
     class json_object<KeyT,Json,typename std::enable_if<std::is_same<typename Json::implementation_policy::key_order,sort_key_order>::value>::type> : 
-        public allocator_holder<typename Json::allocator_type>
+        public allocator_holder<typename Json::allocator_type>, public container_hash_cache
     {
     public:
         using allocator_type = typename Json::allocator_type;
@@ -561,6 +609,7 @@ namespace jsoncons {
 
         json_object(const json_object& val)
             : allocator_holder<allocator_type>(val.get_allocator()),
+              container_hash_cache(),
               members_(val.members_)
         {
         }
@@ -575,6 +624,8 @@ namespace jsoncons {
             : allocator_holder<allocator_type>(val.get_allocator()), 
               members_(std::move(val.members_))
         {
+            cache_hash(val.cached_hash());
+            val.invalidate_hash();
         }
 
         json_object& operator=(json_object&& val)
@@ -591,6 +642,8 @@ namespace jsoncons {
         json_object(json_object&& val,const allocator_type& alloc) 
             : allocator_holder<allocator_type>(alloc), members_(std::move(val.members_),key_value_allocator_type(alloc))
         {
+            cache_hash(val.cached_hash());
+            val.invalidate_hash();
         }
 
         template<class InputIt>
@@ -653,6 +706,8 @@ namespace jsoncons {
         void swap(json_object& val) noexcept
         {
             members_.swap(val.members_);
+            this->invalidate_hash();
+            val.invalidate_hash();
         }
 
         iterator begin()
@@ -679,6 +734,9 @@ namespace jsoncons {
 
         std::size_t capacity() const {return members_.capacity();}
 
+        // Capacity of the lookup index, a sorted object has none
+        std::size_t index_capacity() const {return 0;}
+
         void clear() {members_.clear();}
 
         void shrink_to_fit() 
@@ -762,11 +820,20 @@ namespace jsoncons {
         void insert(InputIt first, InputIt last, Convert convert)
         {
             std::size_t count = std::distance(first,last);
+            const std::size_t old_size = members_.size();
             members_.reserve(members_.size() + count);
             for (auto s = first; s != last; ++s)
             {
                 members_.emplace_back(convert(*s));
             }
+            // Members that arrive in strictly ascending key order, e.g. from canonical CBOR
+            // or from our own encoders, need neither sort nor dedup
+            auto start = old_size == 0 ? members_.begin() : members_.begin() + (old_size - 1);
+            if (std::adjacent_find(start, members_.end(),
+                                   [](const key_value_type& a, const key_value_type& b) -> bool {return a.key().compare(b.key()) >= 0;}) == members_.end())
+            {
+                return;
+            }
             std::stable_sort(members_.begin(),members_.end(),
                              [](const key_value_type& a, const key_value_type& b) -> bool {return a.key().compare(b.key()) < 0;});
             auto it = std::unique(members_.begin(), members_.end(),
@@ -777,26 +844,17 @@ namespace jsoncons {
         template<class InputIt, class Convert>
         void insert(sorted_unique_range_tag, InputIt first, InputIt last, Convert convert)
         {
-            if (first != last)
+            if (!members_.empty())
             {
-                std::size_t count = std::distance(first,last);
-                members_.reserve(members_.size() + count);
-
-                auto it = find(convert(*first).key());
-                if (it != members_.end())
-                {
-                    for (auto s = first; s != last; ++s)
-                    {
-                        it = members_.emplace(it, convert(*s));
-                    }
-                }
-                else
-                {
-                    for (auto s = first; s != last; ++s)
-                    {
-                        members_.emplace_back(convert(*s));
-                    }
-                }
+                // The range may interleave with, or duplicate, existing members
+                insert(first, last, convert);
+                return;
+            }
+            std::size_t count = std::distance(first,last);
+            members_.reserve(count);
+            for (auto s = first; s != last; ++s)
+            {
+                members_.emplace_back(convert(*s));
             }
         }
 
@@ -1224,7 +1282,7 @@ namespace jsoncons {
     // Preserve order
     template <class KeyT,class Json>
     class json_object<KeyT,Json,typename std::enable_if<std::is_same<typename Json::implementation_policy::key_order,preserve_key_order>::value>::type> : 
-        public allocator_holder<typename Json::allocator_type>
+        public allocator_holder<typename Json::allocator_type>, public container_hash_cache
     {
     public:
         using allocator_type = typename Json::allocator_type;
@@ -1260,6 +1318,7 @@ namespace jsoncons {
 
         json_object(const json_object& val)
             : allocator_holder<allocator_type>(val.get_allocator()), 
+              container_hash_cache(),
               members_(val.members_),
               index_(val.index_)
         {
@@ -1277,6 +1336,8 @@ namespace jsoncons {
               members_(std::move(val.members_)),
               index_(std::move(val.index_))
         {
+            cache_hash(val.cached_hash());
+            val.invalidate_hash();
         }
 
         json_object& operator=(json_object&& val)
@@ -1296,6 +1357,8 @@ namespace jsoncons {
               members_(std::move(val.members_),key_value_allocator_type(alloc)),
               index_(std::move(val.index_),index_allocator_type(alloc))
         {
+            cache_hash(val.cached_hash());
+            val.invalidate_hash();
         }
 
         template<class InputIt>
@@ -1393,6 +1456,8 @@ namespace jsoncons {
         void swap(json_object& val) noexcept
         {
             members_.swap(val.members_);
+            this->invalidate_hash();
+            val.invalidate_hash();
         }
 
         bool empty() const
@@ -1424,6 +1489,9 @@ namespace jsoncons {
 
         std::size_t capacity() const {return members_.capacity();}
 
+        // Capacity of the lookup index
+        std::size_t index_capacity() const {return index_.capacity();}
+
         void clear() 
         {
             members_.clear();
@@ -2005,6 +2073,11 @@ namespace jsoncons {
             {
                 index_.push_back(i);
             }
+            if (std::adjacent_find(members_.begin(), members_.end(),
+                                   [](const key_value_type& a, const key_value_type& b) -> bool {return a.key().compare(b.key()) >= 0;}) == members_.end())
+            {
+                return;
+            }
             std::stable_sort(index_.begin(),index_.end(),
                              [&](std::size_t a, std::size_t b) -> bool {return members_.at(a).key().compare(members_.at(b).key()) < 0;});
         }
@@ -32,6 +32,7 @@ public:
     using char_type = CharT;
     using allocator_type = Allocator;
     using string_view_type = jsoncons::basic_string_view<CharT>;
+    using bookmark_type = basic_staj_bookmark<CharT,typename basic_json_parser<CharT,Allocator>::resume_state>;
 private:
     typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<CharT> char_allocator_type;
     static constexpr size_t default_max_buffer_length = 16384;
@@ -43,6 +44,9 @@ private:
     std::size_t buffer_length_;
     bool eof_;
     bool begin_;
+    jsoncons::basic_string_view<CharT> input_;
+    std::size_t input_offset_;
+    detail::staj_event_copy<CharT> seek_event_;
 
     // Noncopyable and nonmoveable
     basic_json_cursor(const basic_json_cursor&) = delete;
@@ -64,7 +68,8 @@ public:
          buffer_(alloc),
          buffer_length_(default_max_buffer_length),
          eof_(false),
-         begin_(true)
+         begin_(true),
+         input_offset_(0)
     {
         buffer_.reserve(buffer_length_);
         if (!done())
@@ -84,7 +89,8 @@ public:
          buffer_(alloc),
          buffer_length_(0),
          eof_(false),
-         begin_(false)
+         begin_(false),
+         input_offset_(0)
     {
         jsoncons::basic_string_view<CharT> sv(std::forward<Source>(source));
         auto result = unicons::skip_bom(sv.begin(), sv.end());
@@ -94,6 +100,8 @@ public:
         }
         std::size_t offset = result.it - sv.begin();
         parser_.update(sv.data()+offset,sv.size()-offset);
+        input_ = sv;
+        input_offset_ = offset;
         if (!done())
         {
             next();
@@ -151,7 +159,8 @@ public:
          buffer_(alloc),
          buffer_length_(default_max_buffer_length),
          eof_(false),
-         begin_(true)
+         begin_(true),
+         input_offset_(0)
     {
         buffer_.reserve(buffer_length_);
         if (!done())
@@ -172,7 +181,8 @@ public:
          buffer_(alloc),
          buffer_length_(0),
          eof_(false),
-         begin_(false)
+         begin_(false),
+         input_offset_(0)
     {
         jsoncons::basic_string_view<CharT> sv(std::forward<Source>(source));
         auto result = unicons::skip_bom(sv.begin(), sv.end());
@@ -183,6 +193,8 @@ public:
         }
         std::size_t offset = result.it - sv.begin();
         parser_.update(sv.data()+offset,sv.size()-offset);
+        input_ = sv;
+        input_offset_ = offset;
         if (!done())
         {
             next(ec);
@@ -244,8 +256,88 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        bool begun = current().event_type() == staj_event_type::begin_object || 
+                     current().event_type() == staj_event_type::begin_array;
+        if (!(begun && parser_.skip_container()))
+        {
+            basic_staj_cursor<CharT>::skip(ec);
+            return;
+        }
+        read_next(ec); // end_object or end_array
+        if (ec || done())
+        {
+            return;
+        }
+        read_next(ec);
+    }
+
+    // The offset, in characters from the start of the input, following the current event
+    std::size_t offset() const
+    {
+        return input_offset_ + parser_.offset();
+    }
+
+    bookmark_type bookmark() const
+    {
+        return bookmark_type(offset(), parser_.save_state(), current());
+    }
+
+    void seek(const bookmark_type& bookmark)
+    {
+        std::error_code ec;
+        seek(bookmark, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Makes the bookmarked event current, and continues parsing from the bookmark offset.
+    // A cursor reading a stream requires a source that can seek.
+    void seek(const bookmark_type& bookmark, std::error_code& ec)
+    {
+        if (input_.data() != nullptr)
+        {
+            if (bookmark.offset() > input_.size())
+            {
+                ec = json_errc::source_error;
+                return;
+            }
+            parser_.restore_state(bookmark.state());
+            parser_.update(input_.data()+bookmark.offset(),input_.size()-bookmark.offset());
+        }
+        else
+        {
+            if (!source_.seek(bookmark.offset()))
+            {
+                ec = json_errc::source_error;
+                return;
+            }
+            buffer_.clear();
+            parser_.restore_state(bookmark.state());
+            eof_ = false;
+            begin_ = false;
+        }
+        input_offset_ = bookmark.offset();
+        seek_event_ = detail::staj_event_copy<CharT>(bookmark.event());
+        cursor_visitor_.event(seek_event_.event());
+    }
+
     void read_buffer(std::error_code& ec)
     {
+        input_offset_ += parser_.offset(); // the previous buffer has been consumed
         buffer_.clear();
         buffer_.resize(buffer_length_);
         std::size_t count = source_.read(buffer_.data(), buffer_length_);
@@ -264,6 +356,7 @@ public:
             }
             std::size_t offset = result.it - buffer_.begin();
             parser_.update(buffer_.data()+offset,buffer_.size()-offset);
+            input_offset_ += offset;
             begin_ = false;
         }
         else
@@ -362,7 +455,8 @@ public:
          buffer_(alloc),
          buffer_length_(default_max_buffer_length),
          eof_(false),
-         begin_(true)
+         begin_(true),
+         input_offset_(0)
     {
         buffer_.reserve(buffer_length_);
         if (!done())
@@ -384,7 +478,8 @@ public:
          buffer_(alloc),
          buffer_length_(0),
          eof_(false),
-         begin_(false)
+         begin_(false),
+         input_offset_(0)
     {
         jsoncons::basic_string_view<CharT> sv(std::forward<Source>(source));
         auto result = unicons::skip_bom(sv.begin(), sv.end());
@@ -394,6 +489,8 @@ public:
         }
         std::size_t offset = result.it - sv.begin();
         parser_.update(sv.data()+offset,sv.size()-offset);
+        input_ = sv;
+        input_offset_ = offset;
         if (!done())
         {
             next();
@@ -458,7 +555,8 @@ public:
          buffer_(alloc),
          buffer_length_(default_max_buffer_length),
          eof_(false),
-         begin_(true)
+         begin_(true),
+         input_offset_(0)
     {
         buffer_.reserve(buffer_length_);
         if (!done())
@@ -481,7 +579,8 @@ public:
          buffer_(alloc),
          buffer_length_(0),
          eof_(false),
-         begin_(false)
+         begin_(false),
+         input_offset_(0)
     {
         jsoncons::basic_string_view<CharT> sv(std::forward<Source>(source));
         auto result = unicons::skip_bom(sv.begin(), sv.end());
@@ -492,6 +591,8 @@ public:
         }
         std::size_t offset = result.it - sv.begin();
         parser_.update(sv.data()+offset,sv.size()-offset);
+        input_ = sv;
+        input_offset_ = offset;
         if (!done())
         {
             next(ec);
@@ -13,8 +13,12 @@
 #include <memory> // std::allocator
 #include <iterator> // std::make_move_iterator
 #include <utility> // std::move
+#include <limits> // std::numeric_limits
+#include <algorithm> // std::min
 #include <jsoncons/json_exception.hpp>
 #include <jsoncons/json_visitor.hpp>
+#include <jsoncons/interned_key.hpp>
+#include <jsoncons/string_arena.hpp>
 
 namespace jsoncons {
 
@@ -34,6 +38,7 @@ public:
     using json_array_allocator = typename array::allocator_type;
     using json_object_allocator = typename object::allocator_type;
     typedef typename std::allocator_traits<result_allocator_type>:: template rebind_alloc<uint8_t> json_byte_allocator_type;
+    using key_intern_table_type = basic_key_intern_table<char_type,std::char_traits<char_type>,json_string_allocator>;
 private:
     struct stack_item
     {
@@ -80,6 +85,14 @@ private:
     std::vector<stack_item,stack_item_allocator_type> item_stack_;
     std::vector<structure_info,structure_info_allocator_type> structure_stack_;
     bool is_valid_;
+    const char_type* borrowed_first_;
+    const char_type* borrowed_last_;
+    const char_type* views_first_;
+    const char_type* views_last_;
+    basic_string_arena<char_type>* views_arena_;
+    bool pack_numeric_arrays_;
+    key_intern_table_type* key_table_;
+    std::unique_ptr<key_intern_table_type> own_key_table_;
 
 public:
     json_decoder(const temp_allocator_type& temp_alloc = temp_allocator_type())
@@ -89,7 +102,14 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
-          is_valid_(false) 
+          is_valid_(false),
+          borrowed_first_(nullptr),
+          borrowed_last_(nullptr),
+          views_first_(nullptr),
+          views_last_(nullptr),
+          views_arena_(nullptr),
+          pack_numeric_arrays_(false),
+          key_table_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -104,7 +124,14 @@ public:
           name_(result_allocator_),
           item_stack_(),
           structure_stack_(),
-          is_valid_(false)
+          is_valid_(false),
+          borrowed_first_(nullptr),
+          borrowed_last_(nullptr),
+          views_first_(nullptr),
+          views_last_(nullptr),
+          views_arena_(nullptr),
+          pack_numeric_arrays_(false),
+          key_table_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -120,7 +147,14 @@ public:
           name_(result_allocator_),
           item_stack_(temp_allocator_),
           structure_stack_(temp_allocator_),
-          is_valid_(false)
+          is_valid_(false),
+          borrowed_first_(nullptr),
+          borrowed_last_(nullptr),
+          views_first_(nullptr),
+          views_last_(nullptr),
+          views_arena_(nullptr),
+          pack_numeric_arrays_(false),
+          key_table_(nullptr)
     {
         item_stack_.reserve(1000);
         structure_stack_.reserve(100);
@@ -133,6 +167,8 @@ public:
         item_stack_.clear();
         structure_stack_.clear();
         structure_stack_.emplace_back(structure_type::root_t, 0);
+        borrowed_first_ = nullptr;
+        borrowed_last_ = nullptr;
     }
 
     bool is_valid() const
@@ -140,10 +176,65 @@ public:
         return is_valid_;
     }
 
+    // String values that lie within source are stored as borrowed strings that reference it,
+    // source must outlive the result. Applies until the next call to get_result() or reset()
+    void borrow_strings_from(const string_view_type& source)
+    {
+        borrowed_first_ = source.data();
+        borrowed_last_ = source.data() + source.length();
+    }
+
+    // String views decoded with this decoder, for example struct members of type string_view, 
+    // reference source where their characters lie within it, and are otherwise copied into arena,
+    // if there is one. source and arena must outlive the decoded values. Unlike borrow_strings_from,
+    // applies across calls to get_result() and reset(), until the next call to borrow_views_from()
+    void borrow_views_from(const string_view_type& source, basic_string_arena<char_type>* arena = nullptr)
+    {
+        views_first_ = source.data();
+        views_last_ = source.data() + source.length();
+        views_arena_ = arena;
+    }
+
+    // Sets result to a view of the characters of sv that outlives the current event, either 
+    // in the source or in the arena. Returns false if there is neither.
+    bool borrow_view(const string_view_type& sv, string_view_type& result)
+    {
+        if (views_first_ != nullptr && sv.data() >= views_first_ && sv.data() + sv.length() <= views_last_)
+        {
+            result = sv;
+            return true;
+        }
+        if (views_arena_ != nullptr)
+        {
+            result = views_arena_->copy(sv);
+            return true;
+        }
+        return false;
+    }
+
+    // Typed arrays, and arrays whose elements are all int64, all uint64 or all double values,
+    // are stored packed rather than as one Json value per element
+    void pack_numeric_arrays(bool value)
+    {
+        pack_numeric_arrays_ = value;
+    }
+
+    // Member names are interned in table, which may be shared with other decoders 
+    // and threads. Without a shared table, a decoder whose Json has interned key 
+    // storage interns into a table of its own that is kept across reset()
+    void intern_keys(key_intern_table_type& table)
+    {
+        static_assert(detail::is_interned_key<key_type>::value, 
+                      "intern_keys requires an implementation policy with interned key storage");
+        key_table_ = &table;
+    }
+
     Json get_result()
     {
         JSONCONS_ASSERT(is_valid_);
         is_valid_ = false;
+        borrowed_first_ = nullptr;
+        borrowed_last_ = nullptr;
         return std::move(result_);
     }
 
@@ -173,6 +264,13 @@ private:
         return true;
     }
 
+    bool visit_begin_object(std::size_t length, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        visit_begin_object(tag, context, ec);
+        reserve_items(length);
+        return true;
+    }
+
     bool visit_end_object(const ser_context&, std::error_code&) override
     {
         JSONCONS_ASSERT(structure_stack_.size() > 0);
@@ -211,6 +309,25 @@ private:
         return true;
     }
 
+    bool visit_begin_array(std::size_t length, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+    {
+        visit_begin_array(tag, context, ec);
+        reserve_items(length);
+        return true;
+    }
+
+    // The length comes from the input and is not trusted, so the
+    // reservation is capped
+    void reserve_items(std::size_t length)
+    {
+        const std::size_t max_hint = 65536;
+        std::size_t n = item_stack_.size() + (std::min)(length, max_hint);
+        if (n > item_stack_.capacity())
+        {
+            item_stack_.reserve(n);
+        }
+    }
+
     bool visit_end_array(const ser_context&, std::error_code&) override
     {
         JSONCONS_ASSERT(structure_stack_.size() > 1);
@@ -225,12 +342,15 @@ private:
 
         if (size > 0)
         {
-            container.reserve(size);
             auto first = item_stack_.begin() + (container_index+1);
             auto last = first + size;
-            for (auto it = first; it != last; ++it)
+            if (!(pack_numeric_arrays_ && pack_elements(container, first, last)))
             {
-                container.push_back(std::move(it->value_));
+                container.reserve(size);
+                for (auto it = first; it != last; ++it)
+                {
+                    container.push_back(std::move(it->value_));
+                }
             }
             item_stack_.erase(first, item_stack_.end());
         }
@@ -246,28 +366,194 @@ private:
         return true;
     }
 
+    template <class Iterator>
+    bool pack_elements(Json& container, Iterator first, Iterator last)
+    {
+        // Signed and unsigned integers may be mixed, the parser reports 
+        // non-negative integers as unsigned
+        storage_kind kind = first->value_.storage();
+        for (auto it = first; it != last; ++it)
+        {
+            if (it->value_.tag() != semantic_tag::none)
+            {
+                return false;
+            }
+            storage_kind other = it->value_.storage();
+            if (other == kind)
+            {
+                continue;
+            }
+            if (other == storage_kind::int64_value && kind == storage_kind::uint64_value)
+            {
+                kind = other;
+            }
+            else if (!(other == storage_kind::uint64_value && kind == storage_kind::int64_value))
+            {
+                return false;
+            }
+        }
+        if (kind == storage_kind::int64_value)
+        {
+            for (auto it = first; it != last; ++it)
+            {
+                if (it->value_.storage() == storage_kind::uint64_value && 
+                    it->value_.template as<uint64_t>() > static_cast<uint64_t>((std::numeric_limits<int64_t>::max)()))
+                {
+                    return false;
+                }
+            }
+        }
+        switch (kind)
+        {
+            case storage_kind::int64_value:
+                container = packed_array<int64_t>(container.tag(), first, last);
+                return true;
+            case storage_kind::uint64_value:
+                container = packed_array<uint64_t>(container.tag(), first, last);
+                return true;
+            case storage_kind::double_value:
+                container = packed_array<double>(container.tag(), first, last);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    template <class T, class Iterator>
+    Json packed_array(semantic_tag tag, Iterator first, Iterator last)
+    {
+        std::vector<T> data;
+        data.reserve(static_cast<std::size_t>(last - first));
+        for (auto it = first; it != last; ++it)
+        {
+            data.push_back(it->value_.template as<T>());
+        }
+        return Json(typed_array_arg, jsoncons::span<const T>(data.data(), data.size()), tag, result_allocator_);
+    }
+
+    template <class T>
+    bool visit_packed_array(const jsoncons::span<const T>& data, semantic_tag tag)
+    {
+        switch (structure_stack_.back().type_)
+        {
+            case structure_type::object_t:
+            case structure_type::array_t:
+                item_stack_.emplace_back(std::forward<key_type>(name_), typed_array_arg, data, tag, result_allocator_);
+                break;
+            case structure_type::root_t:
+                result_ = Json(typed_array_arg, data, tag, result_allocator_);
+                is_valid_ = true;
+                return false;
+        }
+        return true;
+    }
+
+    template <class T>
+    bool visit_unpacked_array(const jsoncons::span<const T>& data, 
+                              semantic_tag tag,
+                              const ser_context& context, 
+                              std::error_code& ec)
+    {
+        bool more = this->begin_array(data.size(), tag, context, ec);
+        for (auto p = data.begin(); more && p != data.end(); ++p)
+        {
+            more = unpacked_value(*p, context, ec);
+        }
+        if (more)
+        {
+            more = this->end_array(context, ec);
+        }
+        return more;
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_unsigned<T>::value,bool>::type
+    unpacked_value(T value, const ser_context& context, std::error_code& ec)
+    {
+        return this->uint64_value(value, semantic_tag::none, context, ec);
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_signed<T>::value && std::is_integral<T>::value,bool>::type
+    unpacked_value(T value, const ser_context& context, std::error_code& ec)
+    {
+        return this->int64_value(value, semantic_tag::none, context, ec);
+    }
+
+    template <class T>
+    typename std::enable_if<std::is_floating_point<T>::value,bool>::type
+    unpacked_value(T value, const ser_context& context, std::error_code& ec)
+    {
+        return this->double_value(value, semantic_tag::none, context, ec);
+    }
+
+    bool visit_unpacked_array(half_arg_t, 
+                              const jsoncons::span<const uint16_t>& data, 
+                              semantic_tag tag,
+                              const ser_context& context, 
+                              std::error_code& ec)
+    {
+        bool more = this->begin_array(data.size(), tag, context, ec);
+        for (auto p = data.begin(); more && p != data.end(); ++p)
+        {
+            more = this->half_value(*p, semantic_tag::none, context, ec);
+        }
+        if (more)
+        {
+            more = this->end_array(context, ec);
+        }
+        return more;
+    }
+
     bool visit_key(const string_view_type& name, const ser_context&, std::error_code&) override
     {
-        name_ = key_type(name.data(),name.length(),result_allocator_);
+        name_ = make_key(name, detail::is_interned_key<key_type>());
         return true;
     }
 
+    key_type make_key(const string_view_type& name, std::false_type)
+    {
+        return key_type(name.data(),name.length(),result_allocator_);
+    }
+
+    key_type make_key(const string_view_type& name, std::true_type)
+    {
+        if (key_table_ == nullptr)
+        {
+            own_key_table_.reset(new key_intern_table_type(result_allocator_));
+            key_table_ = own_key_table_.get();
+        }
+        return key_table_->intern(name);
+    }
+
     bool visit_string(const string_view_type& sv, semantic_tag tag, const ser_context&, std::error_code&) override
     {
         switch (structure_stack_.back().type_)
         {
             case structure_type::object_t:
             case structure_type::array_t:
-                item_stack_.emplace_back(std::forward<key_type>(name_), sv, tag, result_allocator_);
+                if (is_borrowable(sv))
+                {
+                    item_stack_.emplace_back(std::forward<key_type>(name_), borrowed_string_arg, sv, tag, result_allocator_);
+                }
+                else
+                {
+                    item_stack_.emplace_back(std::forward<key_type>(name_), sv, tag, result_allocator_);
+                }
                 break;
             case structure_type::root_t:
-                result_ = Json(sv, tag, result_allocator_);
+                result_ = is_borrowable(sv) ? Json(borrowed_string_arg, sv, tag, result_allocator_) : Json(sv, tag, result_allocator_);
                 is_valid_ = true;
                 return false;
         }
         return true;
     }
 
+    bool is_borrowable(const string_view_type& sv) const
+    {
+        return borrowed_first_ != nullptr && sv.data() >= borrowed_first_ && sv.data() + sv.length() <= borrowed_last_;
+    }
+
     bool visit_byte_string(const byte_string_view& b, 
                            semantic_tag tag, 
                            const ser_context&,
@@ -382,6 +668,110 @@ private:
         return true;
     }
 
+    bool visit_typed_array(const jsoncons::span<const uint8_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint16_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint32_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const uint64_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int8_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int16_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int32_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const int64_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(half_arg_t, 
+                           const jsoncons::span<const uint16_t>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        if (!pack_numeric_arrays_)
+        {
+            return visit_unpacked_array(half_arg, s, tag, context, ec);
+        }
+        switch (structure_stack_.back().type_)
+        {
+            case structure_type::object_t:
+            case structure_type::array_t:
+                item_stack_.emplace_back(std::forward<key_type>(name_), typed_array_arg, half_arg, s, tag, result_allocator_);
+                break;
+            case structure_type::root_t:
+                result_ = Json(typed_array_arg, half_arg, s, tag, result_allocator_);
+                is_valid_ = true;
+                return false;
+        }
+        return true;
+    }
+
+    bool visit_typed_array(const jsoncons::span<const float>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
+    bool visit_typed_array(const jsoncons::span<const double>& s, 
+                           semantic_tag tag,
+                           const ser_context& context, 
+                           std::error_code& ec) override
+    {
+        return pack_numeric_arrays_ ? visit_packed_array(s, tag) : visit_unpacked_array(s, tag, context, ec);
+    }
+
     bool visit_bool(bool value, semantic_tag tag, const ser_context&, std::error_code&) override
     {
         switch (structure_stack_.back().type_)
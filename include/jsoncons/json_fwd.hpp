@@ -12,6 +12,7 @@
 namespace jsoncons {
 
 struct sorted_policy;
+struct interned_sorted_policy;
                         
 template <class CharT, 
           class ImplementationPolicy = sorted_policy, 
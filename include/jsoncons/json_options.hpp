@@ -325,9 +325,11 @@ public:
     using typename super_type::string_type;
 private:
     bool lossless_number_:1;
+    bool borrow_strings_:1;
+    bool pack_numeric_arrays_:1;
 public:
     basic_json_decode_options()
-        : lossless_number_(false)
+        : lossless_number_(false), borrow_strings_(false), pack_numeric_arrays_(false)
     {
     }
 
@@ -335,7 +337,9 @@ public:
 
     basic_json_decode_options(basic_json_decode_options&& other)
         : super_type(std::forward<basic_json_decode_options>(other)),
-                     lossless_number_(other.lossless_number_)
+                     lossless_number_(other.lossless_number_),
+                     borrow_strings_(other.borrow_strings_),
+                     pack_numeric_arrays_(other.pack_numeric_arrays_)
     {
     }
 
@@ -346,6 +350,16 @@ public:
         return lossless_number_;
     }
 
+    bool borrow_strings() const 
+    {
+        return borrow_strings_;
+    }
+
+    bool pack_numeric_arrays() const 
+    {
+        return pack_numeric_arrays_;
+    }
+
 #if !defined(JSONCONS_NO_DEPRECATED)
     JSONCONS_DEPRECATED_MSG("Instead, use lossless_number()")
     bool dec_to_str() const 
@@ -544,6 +558,8 @@ public:
     using basic_json_decode_options<CharT>::neginf_to_num;
 
     using basic_json_decode_options<CharT>::lossless_number;
+    using basic_json_decode_options<CharT>::borrow_strings;
+    using basic_json_decode_options<CharT>::pack_numeric_arrays;
 
     using basic_json_encode_options<CharT>::byte_string_format;
     using basic_json_encode_options<CharT>::bigint_format;
@@ -725,6 +741,18 @@ public:
         return *this;
     }
 
+    basic_json_options& borrow_strings(bool value) 
+    {
+        this->borrow_strings_ = value;
+        return *this;
+    }
+
+    basic_json_options& pack_numeric_arrays(bool value) 
+    {
+        this->pack_numeric_arrays_ = value;
+        return *this;
+    }
+
     basic_json_options& line_length_limit(std::size_t value)
     {
         this->line_length_limit_ = value;
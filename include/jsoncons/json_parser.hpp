@@ -130,6 +130,9 @@ private:
         }
     };
 
+    // States of the scanner that steps over a container without parsing it
+    enum class skip_state : uint8_t {none, value, string, escape, slash, line_comment, block_comment, block_comment_star};
+
     using temp_allocator_type = TempAllocator;
     using char_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<CharT>;
     using parse_state_allocator_type = typename std::allocator_traits<temp_allocator_type>:: template rebind_alloc<json_parse_state>;
@@ -152,6 +155,8 @@ private:
     const CharT* input_end_;
     const CharT* input_ptr_;
     json_parse_state state_;
+    skip_state skip_state_;
+    int skip_level_;
     bool more_;
     bool done_;
 
@@ -166,6 +171,22 @@ private:
     basic_json_parser& operator=(const basic_json_parser&) = delete;
 
 public:
+    // The state needed to continue parsing from a point between events
+    struct resume_state
+    {
+        json_parse_state state;
+        std::vector<json_parse_state> state_stack;
+        int nesting_depth;
+        std::size_t line;
+        std::size_t position;
+        std::size_t mark_position;
+
+        resume_state()
+            : state(json_parse_state::start), nesting_depth(0), line(1), position(0), mark_position(0)
+        {
+        }
+    };
+
     basic_json_parser(const TempAllocator& alloc = TempAllocator())
         : basic_json_parser(basic_json_decode_options<CharT>(), default_json_parsing(), alloc)
     {
@@ -200,6 +221,8 @@ public:
          input_end_(nullptr),
          input_ptr_(nullptr),
          state_(json_parse_state::start),
+         skip_state_(skip_state::none),
+         skip_level_(0),
          more_(true),
          done_(false),
          string_buffer_(alloc),
@@ -445,6 +468,8 @@ public:
         state_stack_.reserve(initial_stack_capacity_);
         push_state(json_parse_state::root);
         state_ = json_parse_state::start;
+        skip_state_ = skip_state::none;
+        skip_level_ = 0;
         more_ = true;
         done_ = false;
         line_ = 1;
@@ -458,6 +483,62 @@ public:
         more_ = true;
     }
 
+    // Called after begin_object or begin_array has been reported. The following 
+    // calls to parse_some step over the contents of the container, matching only 
+    // brackets, strings and comments, and report just its end_object or end_array.
+    // The skipped contents are not validated. Returns false if no container has 
+    // just begun.
+    bool skip_container()
+    {
+        if (state_ != json_parse_state::expect_member_name_or_end && state_ != json_parse_state::expect_value_or_end)
+        {
+            return false;
+        }
+        state_ = json_parse_state::expect_comma_or_end;
+        skip_state_ = skip_state::value;
+        skip_level_ = 1;
+        return true;
+    }
+
+    bool skipping() const
+    {
+        return skip_state_ != skip_state::none;
+    }
+
+    // The number of characters consumed from the input given to the last update
+    std::size_t offset() const
+    {
+        return input_ptr_ - begin_input_;
+    }
+
+    resume_state save_state() const
+    {
+        resume_state rs;
+        rs.state = state_;
+        rs.state_stack.assign(state_stack_.begin(), state_stack_.end());
+        rs.nesting_depth = nesting_depth_;
+        rs.line = line_;
+        rs.position = position_;
+        rs.mark_position = mark_position_;
+        return rs;
+    }
+
+    // Continues from a saved state, with input to be given by update
+    void restore_state(const resume_state& rs)
+    {
+        state_ = rs.state;
+        state_stack_.assign(rs.state_stack.begin(), rs.state_stack.end());
+        nesting_depth_ = rs.nesting_depth;
+        line_ = rs.line;
+        position_ = rs.position;
+        mark_position_ = rs.mark_position;
+        skip_state_ = skip_state::none;
+        skip_level_ = 0;
+        more_ = true;
+        done_ = false;
+        begin_input_ = input_end_ = input_ptr_ = nullptr;
+    }
+
     void check_done()
     {
         std::error_code ec;
@@ -552,6 +633,21 @@ public:
             more_ = false;
             return;
         }
+        if (skip_state_ != skip_state::none)
+        {
+            if (input_ptr_ == input_end_)
+            {
+                err_handler_(json_errc::unexpected_eof, *this);
+                ec = json_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            skip_some();
+            if (skip_state_ != skip_state::none)
+            {
+                return;
+            }
+        }
         const CharT* local_input_end = input_end_;
 
         if (input_ptr_ == local_input_end && more_)
@@ -2776,6 +2872,115 @@ private:
         }
     }
 
+    // Scans to the bracket that closes the container being skipped, and leaves 
+    // it to be parsed. Stops at the end of the input otherwise.
+    void skip_some()
+    {
+        const CharT* p = input_ptr_;
+        const CharT* local_input_end = input_end_;
+
+        while (p != local_input_end)
+        {
+            switch (skip_state_)
+            {
+                case skip_state::value:
+                    switch (*p)
+                    {
+                        case '{':
+                        case '[':
+                            ++skip_level_;
+                            break;
+                        case '}':
+                        case ']':
+                            if (--skip_level_ == 0)
+                            {
+                                skip_state_ = skip_state::none;
+                                position_ += (p - input_ptr_);
+                                input_ptr_ = p;
+                                return;
+                            }
+                            break;
+                        case '\"':
+                            skip_state_ = skip_state::string;
+                            break;
+                        case '/':
+                            skip_state_ = skip_state::slash;
+                            break;
+                        case '\n':
+                            ++line_;
+                            mark_position_ = position_ + (p - input_ptr_) + 1;
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+                case skip_state::string:
+                    switch (*p)
+                    {
+                        case '\"':
+                            skip_state_ = skip_state::value;
+                            break;
+                        case '\\':
+                            skip_state_ = skip_state::escape;
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+                case skip_state::escape:
+                    skip_state_ = skip_state::string;
+                    break;
+                case skip_state::slash:
+                    switch (*p)
+                    {
+                        case '/':
+                            skip_state_ = skip_state::line_comment;
+                            break;
+                        case '*':
+                            skip_state_ = skip_state::block_comment;
+                            break;
+                        default:
+                            skip_state_ = skip_state::value;
+                            continue;
+                    }
+                    break;
+                case skip_state::line_comment:
+                    if (*p == '\n')
+                    {
+                        ++line_;
+                        mark_position_ = position_ + (p - input_ptr_) + 1;
+                        skip_state_ = skip_state::value;
+                    }
+                    break;
+                case skip_state::block_comment:
+                case skip_state::block_comment_star:
+                    switch (*p)
+                    {
+                        case '*':
+                            skip_state_ = skip_state::block_comment_star;
+                            break;
+                        case '/':
+                            skip_state_ = skip_state_ == skip_state::block_comment_star ? skip_state::value : skip_state::block_comment;
+                            break;
+                        case '\n':
+                            ++line_;
+                            mark_position_ = position_ + (p - input_ptr_) + 1;
+                            skip_state_ = skip_state::block_comment;
+                            break;
+                        default:
+                            skip_state_ = skip_state::block_comment;
+                            break;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            ++p;
+        }
+        position_ += (p - input_ptr_);
+        input_ptr_ = p;
+    }
+
     void push_state(json_parse_state state)
     {
         state_stack_.push_back(state);
@@ -0,0 +1,69 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_SEQUENCE_ERROR_HPP
+#define JSONCONS_JSON_SEQUENCE_ERROR_HPP
+
+#include <system_error>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+
+    enum class json_sequence_errc
+    {
+        success = 0,
+        expected_record_separator = 1,
+        truncated_record,
+        record_too_long
+    };
+
+    class json_sequence_error_category_impl
+       : public std::error_category
+    {
+    public:
+        const char* name() const noexcept override
+        {
+            return "jsoncons/json_sequence";
+        }
+        std::string message(int ev) const override
+        {
+            switch (static_cast<json_sequence_errc>(ev))
+            {
+                case json_sequence_errc::expected_record_separator:
+                    return "Expected a record separator before the JSON text";
+                case json_sequence_errc::truncated_record:
+                    return "Record may have been truncated";
+                case json_sequence_errc::record_too_long:
+                    return "Record exceeds the maximum record length";
+                default:
+                    return "Unknown JSON sequence error";
+            }
+        }
+    };
+
+    inline
+    const std::error_category& json_sequence_error_category()
+    {
+      static json_sequence_error_category_impl instance;
+      return instance;
+    }
+
+    inline
+    std::error_code make_error_code(json_sequence_errc result)
+    {
+        return std::error_code(static_cast<int>(result),json_sequence_error_category());
+    }
+
+} // jsoncons
+
+namespace std {
+    template<>
+    struct is_error_code_enum<jsoncons::json_sequence_errc> : public true_type
+    {
+    };
+}
+
+#endif
@@ -0,0 +1,547 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_JSON_SEQUENCE_READER_HPP
+#define JSONCONS_JSON_SEQUENCE_READER_HPP
+
+#include <cstdint>
+#include <cstring> // std::memchr
+#include <limits> // std::numeric_limits
+#include <memory> // std::allocator
+#include <string>
+#include <system_error>
+#include <utility> // std::forward
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/conv_error.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_parser.hpp>
+#include <jsoncons/json_sequence_error.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/source.hpp>
+
+namespace jsoncons {
+
+    enum class json_sequence_format : uint8_t
+    {
+        text_sequence = 1,  // RFC 7464, each JSON text preceded by a record separator (0x1E) and followed by a line feed
+        json_lines,         // one JSON text per line
+        concatenated        // JSON texts one after another, optionally separated by whitespace
+    };
+
+// Reads a sequence of JSON texts one record at a time. A record that fails to parse
+// is reported, and reading resumes at the start of the next record.
+template<class Src=jsoncons::stream_source<char>,class Allocator=std::allocator<char>>
+class basic_json_sequence_reader
+{
+public:
+    using char_type = char;
+    using source_type = Src;
+    using allocator_type = Allocator;
+private:
+    typedef typename std::allocator_traits<allocator_type>:: template rebind_alloc<char> char_allocator_type;
+    static constexpr size_t default_max_buffer_length = 16384;
+    static constexpr char record_separator = '\x1e';
+
+    source_type source_;
+    json_sequence_format format_;
+    basic_json_decode_options<char> options_;
+    basic_json_parser<char,Allocator> parser_;
+    std::vector<char,char_allocator_type> buffer_;
+    std::size_t buffer_length_;
+    std::size_t position_;
+    uint64_t buffer_offset_;
+    bool begin_;
+    bool eof_;
+    std::basic_string<char,std::char_traits<char>,char_allocator_type> record_;
+    std::size_t max_record_length_;
+    uint64_t record_offset_;
+    uint64_t record_length_;
+    std::size_t record_number_;
+    std::error_code record_ec_;
+
+    // Noncopyable and nonmoveable
+    basic_json_sequence_reader(const basic_json_sequence_reader&) = delete;
+    basic_json_sequence_reader& operator=(const basic_json_sequence_reader&) = delete;
+
+public:
+    template <class Source>
+    basic_json_sequence_reader(Source&& source,
+                               json_sequence_format format = json_sequence_format::text_sequence,
+                               const basic_json_decode_options<char>& options = basic_json_decode_options<char>(),
+                               const Allocator& alloc = Allocator())
+       : source_(std::forward<Source>(source)),
+         format_(format),
+         options_(options),
+         parser_(options,default_json_parsing(),alloc),
+         buffer_(alloc),
+         buffer_length_(default_max_buffer_length),
+         position_(0),
+         buffer_offset_(0),
+         begin_(true),
+         eof_(false),
+         record_(alloc),
+         max_record_length_((std::numeric_limits<std::size_t>::max)()),
+         record_offset_(0),
+         record_length_(0),
+         record_number_(0)
+    {
+    }
+
+    json_sequence_format format() const
+    {
+        return format_;
+    }
+
+    std::size_t buffer_length() const
+    {
+        return buffer_length_;
+    }
+
+    void buffer_length(std::size_t length)
+    {
+        buffer_length_ = length;
+    }
+
+    // Records longer than this are reported with json_sequence_errc::record_too_long
+    // without being kept in memory
+    std::size_t max_record_length() const
+    {
+        return max_record_length_;
+    }
+
+    void max_record_length(std::size_t length)
+    {
+        max_record_length_ = length;
+    }
+
+    // The offset, in bytes from the start of the input, of the last record read
+    uint64_t record_offset() const
+    {
+        return record_offset_;
+    }
+
+    uint64_t record_length() const
+    {
+        return record_length_;
+    }
+
+    // The number of records read so far, including those with errors
+    std::size_t record_number() const
+    {
+        return record_number_;
+    }
+
+    bool eof() const
+    {
+        return eof_ && position_ == buffer_.size();
+    }
+
+    // Reports the next record to visitor. Returns false at the end of the input,
+    // or if the source fails. Otherwise returns true, with ec set if the record is
+    // not valid, in which case some of its events may have been reported.
+    bool read_next(basic_json_visitor<char>& visitor, std::error_code& ec)
+    {
+        if (!next_record(ec))
+        {
+            return false;
+        }
+        if (record_ec_)
+        {
+            ec = record_ec_;
+            return true;
+        }
+        parser_.reset();
+        parser_.update(record_.data(), record_.size());
+        parser_.finish_parse(visitor, ec);
+        if (!ec)
+        {
+            parser_.check_done(ec);
+        }
+        return true;
+    }
+
+    bool read_next(basic_json_visitor<char>& visitor)
+    {
+        std::error_code ec;
+        bool more = read_next(visitor, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, static_cast<std::size_t>(record_offset_)));
+        }
+        return more;
+    }
+
+    // Decodes the next record into value. Returns as read_next, leaving value
+    // unchanged if the record is not valid.
+    template <class T>
+    bool decode_next(T& value, std::error_code& ec)
+    {
+        if (!next_record(ec))
+        {
+            return false;
+        }
+        if (record_ec_)
+        {
+            ec = record_ec_;
+            return true;
+        }
+        basic_json_cursor<char,string_source<char>> cursor(jsoncons::string_view(record_.data(), record_.size()),
+                                                           options_, default_json_parsing(), ec);
+        if (ec)
+        {
+            return true;
+        }
+        json_decoder<basic_json<char>> decoder;
+        // Traits that decode through basic_json report a parse error or a mismatch by throwing
+        JSONCONS_TRY
+        {
+            T val = decode_traits<T,char>::decode(cursor, decoder, ec);
+            if (!ec)
+            {
+                cursor.check_done(ec);
+            }
+            if (!ec)
+            {
+                value = std::move(val);
+            }
+        }
+        JSONCONS_CATCH(const ser_error&)
+        {
+            if (!ec)
+            {
+                ec = conv_errc::conversion_failed;
+            }
+        }
+        JSONCONS_CATCH(const conv_error&)
+        {
+            ec = conv_errc::conversion_failed;
+        }
+        return true;
+    }
+
+    template <class T>
+    bool decode_next(T& value)
+    {
+        std::error_code ec;
+        bool more = decode_next(value, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, static_cast<std::size_t>(record_offset_)));
+        }
+        return more;
+    }
+
+private:
+    uint64_t offset() const
+    {
+        return buffer_offset_ + position_;
+    }
+
+    bool fill(std::error_code& ec)
+    {
+        if (position_ < buffer_.size())
+        {
+            return true;
+        }
+        if (eof_)
+        {
+            return false;
+        }
+        buffer_offset_ += buffer_.size();
+        buffer_.resize(buffer_length_);
+        std::size_t count = source_.read(buffer_.data(), buffer_length_);
+        buffer_.resize(count);
+        position_ = 0;
+        if (source_.is_error())
+        {
+            ec = json_errc::source_error;
+            eof_ = true;
+            return false;
+        }
+        if (count == 0)
+        {
+            eof_ = true;
+            return false;
+        }
+        if (begin_)
+        {
+            begin_ = false;
+            if (count >= 3 && static_cast<uint8_t>(buffer_[0]) == 0xef &&
+                static_cast<uint8_t>(buffer_[1]) == 0xbb && static_cast<uint8_t>(buffer_[2]) == 0xbf)
+            {
+                position_ = 3;
+                return fill(ec);
+            }
+        }
+        return true;
+    }
+
+    static bool is_space(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    void begin_record()
+    {
+        record_.clear();
+        record_ec_ = std::error_code();
+        record_offset_ = offset();
+    }
+
+    void end_record()
+    {
+        record_length_ = offset() - record_offset_;
+        ++record_number_;
+    }
+
+    void append(const char* data, std::size_t length)
+    {
+        if (record_ec_ == json_sequence_errc::record_too_long)
+        {
+            return;
+        }
+        if (length > max_record_length_ - record_.size())
+        {
+            record_ec_ = json_sequence_errc::record_too_long;
+            record_.clear();
+            return;
+        }
+        record_.append(data, length);
+    }
+
+    // Keeps the characters up to, but not including, delimiter, or up to the end of the input
+    bool collect_until(char delimiter, std::error_code& ec)
+    {
+        while (fill(ec))
+        {
+            const char* first = buffer_.data() + position_;
+            std::size_t length = buffer_.size() - position_;
+            const char* found = static_cast<const char*>(std::memchr(first, delimiter, length));
+            std::size_t count = found != nullptr ? static_cast<std::size_t>(found - first) : length;
+            append(first, count);
+            position_ += count;
+            if (found != nullptr)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool only_space() const
+    {
+        for (char c : record_)
+        {
+            if (!is_space(c))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool skip_space(std::error_code& ec)
+    {
+        while (fill(ec))
+        {
+            if (!is_space(buffer_[position_]))
+            {
+                return true;
+            }
+            ++position_;
+        }
+        return false;
+    }
+
+    bool next_record(std::error_code& ec)
+    {
+        switch (format_)
+        {
+            case json_sequence_format::text_sequence:
+                return next_text_sequence_record(ec);
+            case json_sequence_format::json_lines:
+                return next_line_record(ec);
+            default:
+                return next_concatenated_record(ec);
+        }
+    }
+
+    bool next_text_sequence_record(std::error_code& ec)
+    {
+        while (skip_space(ec))
+        {
+            if (buffer_[position_] != record_separator)
+            {
+                // Text outside a record, reported as one record up to the next separator
+                begin_record();
+                collect_until(record_separator, ec);
+                end_record();
+                if (!ec)
+                {
+                    record_ec_ = json_sequence_errc::expected_record_separator;
+                }
+                return !ec;
+            }
+            ++position_;
+            begin_record();
+            collect_until(record_separator, ec);
+            if (ec)
+            {
+                return false;
+            }
+            if (record_ec_ || !only_space())
+            {
+                end_record();
+                check_truncated();
+                return true;
+            }
+            // Empty records are ignored
+        }
+        return false;
+    }
+
+    // A number, true, false or null without its final line feed may have been cut short (RFC 7464, section 2.4)
+    void check_truncated()
+    {
+        if (record_ec_ || record_.back() == '\n')
+        {
+            return;
+        }
+        for (char c : record_)
+        {
+            if (!is_space(c))
+            {
+                if (c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n')
+                {
+                    record_ec_ = json_sequence_errc::truncated_record;
+                }
+                return;
+            }
+        }
+    }
+
+    bool next_line_record(std::error_code& ec)
+    {
+        while (fill(ec))
+        {
+            begin_record();
+            bool terminated = collect_until('\n', ec);
+            if (ec)
+            {
+                return false;
+            }
+            bool empty = !record_ec_ && only_space();
+            if (!empty)
+            {
+                end_record();
+            }
+            if (terminated)
+            {
+                ++position_;
+            }
+            if (!empty)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool next_concatenated_record(std::error_code& ec)
+    {
+        if (!skip_space(ec))
+        {
+            return false;
+        }
+        begin_record();
+        std::size_t level = 0;
+        bool in_string = false;
+        bool escape = false;
+        bool scalar = false;
+        bool first = true;
+        bool more = true;
+        while (more && fill(ec))
+        {
+            const char* p = buffer_.data();
+            std::size_t start = position_;
+            std::size_t i = position_;
+            for (; more && i < buffer_.size(); ++i)
+            {
+                char c = p[i];
+                if (in_string)
+                {
+                    if (escape)
+                    {
+                        escape = false;
+                    }
+                    else if (c == '\\')
+                    {
+                        escape = true;
+                    }
+                    else if (c == '\"')
+                    {
+                        in_string = false;
+                        more = level > 0;
+                    }
+                    continue;
+                }
+                if (scalar)
+                {
+                    if (is_space(c) || c == '{' || c == '[' || c == '}' || c == ']' || c == '\"')
+                    {
+                        more = false;
+                        break;
+                    }
+                    continue;
+                }
+                switch (c)
+                {
+                    case '{':
+                    case '[':
+                        ++level;
+                        break;
+                    case '}':
+                    case ']':
+                        // An unmatched closing bracket is a record by itself, and fails to parse
+                        if (level > 0)
+                        {
+                            --level;
+                        }
+                        more = level > 0;
+                        break;
+                    case '\"':
+                        in_string = true;
+                        break;
+                    default:
+                        if (first)
+                        {
+                            scalar = true;
+                        }
+                        break;
+                }
+                first = false;
+            }
+            append(p + start, i - start);
+            position_ = i;
+        }
+        if (ec)
+        {
+            return false;
+        }
+        end_record();
+        return true;
+    }
+};
+
+using json_sequence_reader = basic_json_sequence_reader<jsoncons::stream_source<char>>;
+
+} // namespace jsoncons
+
+#endif
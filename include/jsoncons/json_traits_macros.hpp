@@ -8,15 +8,24 @@
 #define JSONCONS_JSON_TRAITS_MACROS_HPP
 
 #include <algorithm> // std::swap
+#include <bitset> // std::bitset
 #include <iterator> // std::iterator_traits, std::input_iterator_tag
 #include <jsoncons/config/jsoncons_config.hpp> // JSONCONS_EXPAND, JSONCONS_QUOTE
 #include <jsoncons/detail/more_type_traits.hpp>
 #include <jsoncons/json_visitor.hpp>
 #include <limits> // std::numeric_limits
+#include <memory> // std::shared_ptr, std::unique_ptr
 #include <string>
+#include <typeindex> // std::type_index
 #include <type_traits> // std::enable_if
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #include <jsoncons/json_type_traits.hpp>
+#include <jsoncons/json_filter.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/encode_traits.hpp>
+#include <jsoncons/detail/name_index.hpp>
 
 namespace jsoncons
 {
@@ -91,6 +100,401 @@ namespace jsoncons
             j.try_emplace(key, val); 
         } 
     };
+
+    template <class CharT>
+    struct decode_traits_helper
+    {
+        // Moves to the last event of the current value, as decode does
+        static void skip_value(basic_staj_cursor<CharT>& cursor, std::error_code& ec) 
+        { 
+            std::size_t level = 0;
+            for (;;)
+            {
+                switch (cursor.current().event_type())
+                {
+                    case staj_event_type::begin_array:
+                    case staj_event_type::begin_object:
+                        ++level;
+                        break;
+                    case staj_event_type::end_array:
+                    case staj_event_type::end_object:
+                        --level;
+                        break;
+                    default:
+                        break;
+                }
+                if (level == 0 || cursor.done())
+                {
+                    return;
+                }
+                cursor.next(ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+        } 
+
+        // A const member is read past, as set_udt_member leaves it alone
+        template <class Json, class TempAllocator, class OutputType> 
+        static void decode_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>&, 
+                                  const OutputType&, std::error_code& ec) 
+        { 
+            skip_value(cursor, ec);
+        } 
+        template <class Json, class TempAllocator, class OutputType> 
+        static void decode_member(basic_staj_cursor<CharT>& cursor, json_decoder<Json,TempAllocator>& decoder, 
+                                  OutputType& val, std::error_code& ec) 
+        { 
+            decode_into_traits<OutputType,CharT>::decode_into(cursor, decoder, val, ec);
+        } 
+
+        // A member that is absent when decoding into an existing value gets its default
+        template <class OutputType> 
+        static void reset_member(const OutputType&, const OutputType&) 
+        { 
+        } 
+        template <class OutputType> 
+        static void reset_member(OutputType& val, OutputType& default_val) 
+        { 
+            val = std::move(default_val);
+        } 
+    };
+
+    template <class CharT>
+    struct encode_traits_helper
+    {
+        // Whether a member that isn't mandatory is written, as with set_optional_json_member
+        template <class U> 
+        static bool is_present(const std::shared_ptr<U>& val) 
+        { 
+            return val.get() != nullptr; 
+        } 
+        template <class U> 
+        static bool is_present(const std::unique_ptr<U>& val) 
+        { 
+            return val.get() != nullptr; 
+        } 
+        template <class U> 
+        static bool is_present(const jsoncons::optional<U>& val) 
+        { 
+            return val.has_value(); 
+        } 
+        template <class U> 
+        static bool is_present(const U&) 
+        { 
+            return true; 
+        } 
+
+        template <class Json, class U> 
+        static void encode_member(const CharT* name, const U& val, basic_json_visitor<CharT>& encoder, 
+                                  const Json& proto, std::error_code& ec) 
+        { 
+            encoder.key(basic_string_view<CharT>(name), ser_context(), ec);
+            if (ec) return;
+            encode_traits<U,CharT>::encode(val, encoder, proto, ec);
+        } 
+    };
+
+    // Declared by JSONCONS_POLYMORPHIC_TAG_TRAITS for a base class, maps derived classes 
+    // to and from the tags written under the discriminator key
+    template <class BaseClass>
+    struct polymorphic_tags;
+
+    // The discriminator key and the tags of a polymorphic hierarchy, in CharT
+    template <class CharT>
+    class polymorphic_tag_table
+    {
+        std::basic_string<CharT> key_;
+        std::vector<std::basic_string<CharT>> tags_;
+        jsoncons::detail::name_index<CharT> index_;
+
+        // noncopyable and nonmoveable, the index points into tags_
+        polymorphic_tag_table(const polymorphic_tag_table&) = delete;
+        polymorphic_tag_table& operator=(const polymorphic_tag_table&) = delete;
+    public:
+        static constexpr std::size_t npos = jsoncons::detail::name_index<CharT>::npos;
+
+        polymorphic_tag_table(const char* key, const char* const* tags, std::size_t count)
+            : key_(widen(key)), tags_(count), index_(init_tags(tags_, tags, count))
+        {
+        }
+
+        basic_string_view<CharT> key() const
+        {
+            return basic_string_view<CharT>(key_);
+        }
+
+        basic_string_view<CharT> tag(std::size_t i) const
+        {
+            return basic_string_view<CharT>(tags_[i]);
+        }
+
+        // Returns the position of the class with this tag, or npos
+        std::size_t find(const basic_string_view<CharT>& tag) const
+        {
+            return index_.find(tag.data(), tag.size());
+        }
+    private:
+        static std::basic_string<CharT> widen(const char* s)
+        {
+            std::basic_string<CharT> result;
+            for (; *s != 0; ++s)
+            {
+                result.push_back(static_cast<CharT>(*s));
+            }
+            return result;
+        }
+
+        static std::vector<const CharT*> init_tags(std::vector<std::basic_string<CharT>>& tags, 
+                                                   const char* const* names, std::size_t count)
+        {
+            std::vector<const CharT*> ptrs(count);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                tags[i] = widen(names[i]);
+                ptrs[i] = tags[i].c_str();
+            }
+            return ptrs;
+        }
+    };
+
+    template <class CharT>
+    constexpr std::size_t polymorphic_tag_table<CharT>::npos;
+
+    // Writes the discriminator key and tag at the start of the first object it is given
+    template <class CharT>
+    class polymorphic_tag_visitor : public basic_json_filter<CharT>
+    {
+        basic_string_view<CharT> key_;
+        basic_string_view<CharT> tag_;
+        bool tagged_;
+    public:
+        polymorphic_tag_visitor(basic_json_visitor<CharT>& visitor, 
+                                const basic_string_view<CharT>& key, 
+                                const basic_string_view<CharT>& tag)
+            : basic_json_filter<CharT>(visitor), key_(key), tag_(tag), tagged_(false)
+        {
+        }
+    private:
+        bool visit_begin_object(semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            this->destination().begin_object(tag, context, ec);
+            return write_tag(context, ec);
+        }
+
+        bool visit_begin_object(std::size_t length, semantic_tag tag, const ser_context& context, std::error_code& ec) override
+        {
+            this->destination().begin_object(tagged_ ? length : length+1, tag, context, ec);
+            return write_tag(context, ec);
+        }
+
+        bool write_tag(const ser_context& context, std::error_code& ec)
+        {
+            if (ec)
+            {
+                return false;
+            }
+            if (tagged_)
+            {
+                return true;
+            }
+            tagged_ = true;
+            this->destination().key(key_, context, ec);
+            if (ec)
+            {
+                return false;
+            }
+            return this->destination().string_value(tag_, semantic_tag::none, context, ec);
+        }
+    };
+
+    // Reports a begin_object that has already been read from the cursor, 
+    // followed by the rest of the object from the cursor
+    template <class CharT>
+    class resumed_object_cursor : public basic_staj_cursor<CharT>
+    {
+        basic_staj_cursor<CharT>* cursor_;
+        basic_staj_event<CharT> begin_event_;
+        bool at_begin_;
+    public:
+        resumed_object_cursor(basic_staj_cursor<CharT>& cursor)
+            : cursor_(std::addressof(cursor)), begin_event_(staj_event_type::begin_object), at_begin_(true)
+        {
+        }
+
+        bool done() const override
+        {
+            return !at_begin_ && cursor_->done();
+        }
+
+        const basic_staj_event<CharT>& current() const override
+        {
+            return at_begin_ ? begin_event_ : cursor_->current();
+        }
+
+        void read_to(basic_json_visitor<CharT>& visitor) override
+        {
+            std::error_code ec;
+            read_to(visitor, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+            }
+        }
+
+        void read_to(basic_json_visitor<CharT>& visitor,
+                     std::error_code& ec) override
+        {
+            if (!at_begin_)
+            {
+                cursor_->read_to(visitor, ec);
+                return;
+            }
+            at_begin_ = false;
+            visitor.begin_object(semantic_tag::none, context(), ec);
+            std::size_t level = 1;
+            while (!ec && !cursor_->done())
+            {
+                const basic_staj_event<CharT>& event = cursor_->current();
+                switch (event.event_type())
+                {
+                    case staj_event_type::begin_array:
+                    case staj_event_type::begin_object:
+                        ++level;
+                        break;
+                    case staj_event_type::end_array:
+                    case staj_event_type::end_object:
+                        --level;
+                        break;
+                    default:
+                        break;
+                }
+                staj_to_saj_event(event, visitor, context(), ec);
+                if (ec || level == 0)
+                {
+                    return;
+                }
+                cursor_->next(ec);
+            }
+        }
+
+        void next() override
+        {
+            std::error_code ec;
+            next(ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+            }
+        }
+
+        void next(std::error_code& ec) override
+        {
+            if (at_begin_)
+            {
+                at_begin_ = false;
+            }
+            else
+            {
+                cursor_->next(ec);
+            }
+        }
+
+        const ser_context& context() const override
+        {
+            return cursor_->context();
+        }
+    };
+
+    template <class CharT>
+    struct polymorphic_traits_helper
+    {
+        template <class DerivedClass, class BaseClass> 
+        static void assign(std::shared_ptr<BaseClass>& ptr, DerivedClass&& val) 
+        { 
+            ptr = std::make_shared<DerivedClass>(std::move(val));
+        } 
+        template <class DerivedClass, class BaseClass> 
+        static void assign(std::unique_ptr<BaseClass>& ptr, DerivedClass&& val) 
+        { 
+            ptr = jsoncons::make_unique<DerivedClass>(std::move(val));
+        } 
+
+        // Reads the tag if the discriminator is the first member and decodes that class 
+        // from the rest of the object, otherwise reads the object and decodes from that 
+        template <class Pointer, class Json, class TempAllocator> 
+        static Pointer decode(basic_staj_cursor<CharT>& cursor, 
+                              json_decoder<Json,TempAllocator>& decoder, 
+                              std::error_code& ec) 
+        { 
+            using base_type = typename Pointer::element_type;
+            using tags_type = polymorphic_tags<base_type>;
+
+            Pointer ptr;
+            if (cursor.current().event_type() != staj_event_type::begin_object) 
+            { 
+                decode_traits_helper<CharT>::skip_value(cursor, ec);
+                return ptr;
+            } 
+            const polymorphic_tag_table<CharT>& table = tags_type::template table<CharT>();
+            cursor.next(ec);
+            if (ec) return ptr;
+            resumed_object_cursor<CharT> resumed(cursor);
+            if (cursor.current().event_type() != staj_event_type::key || 
+                cursor.current().template get<basic_string_view<CharT>>(ec) != table.key()) 
+            { 
+                if (ec) return ptr;
+                decoder.reset();
+                resumed.read_to(decoder, ec);
+                if (ec) return ptr;
+                if (!decoder.is_valid())
+                {
+                    ec = conv_errc::conversion_failed;
+                    return ptr;
+                }
+                return decoder.get_result().template as<Pointer>();
+            } 
+            cursor.next(ec);
+            if (ec) return ptr;
+            if (cursor.current().event_type() != staj_event_type::string_value) 
+            { 
+                ec = conv_errc::conversion_failed;
+                return ptr;
+            } 
+            std::size_t i = table.find(cursor.current().template get<basic_string_view<CharT>>(ec));
+            if (ec) return ptr;
+            cursor.next(ec);
+            if (ec) return ptr;
+            if (i == table.npos) 
+            { 
+                decode_traits_helper<CharT>::skip_value(resumed, ec);
+                return ptr;
+            } 
+            tags_type::decode_class(i, resumed, decoder, ptr, ec);
+            return ptr;
+        } 
+
+        template <class Pointer, class Json> 
+        static void encode(const Pointer& ptr, 
+                           basic_json_visitor<CharT>& encoder, 
+                           const Json& proto, 
+                           std::error_code& ec) 
+        { 
+            using base_type = typename Pointer::element_type;
+            using tags_type = polymorphic_tags<base_type>;
+
+            std::size_t i = ptr ? tags_type::class_of(*ptr) : polymorphic_tag_table<CharT>::npos;
+            if (i == polymorphic_tag_table<CharT>::npos) 
+            { 
+                encoder.null_value(semantic_tag::none, ser_context(), ec);
+                return;
+            } 
+            const polymorphic_tag_table<CharT>& table = tags_type::template table<CharT>();
+            polymorphic_tag_visitor<CharT> visitor(encoder, table.key(), table.tag(i));
+            tags_type::encode_class(i, *ptr, visitor, proto, ec);
+        } 
+    };
 }
 
 #if defined(_MSC_VER)
@@ -165,7 +569,11 @@ namespace jsoncons
 
 #define JSONCONS_TYPE_TRAITS_FRIEND \
     template <class JSON,class T,class Enable> \
-    friend struct jsoncons::json_type_traits;
+    friend struct jsoncons::json_type_traits; \
+    template <class T,class CharT,class Enable> \
+    friend struct jsoncons::decode_traits; \
+    template <class T,class CharT,class Enable> \
+    friend struct jsoncons::encode_traits;
 
 #define JSONCONS_EXPAND_CALL2(Call, Expr, Id) JSONCONS_EXPAND(Call(Expr, Id))
 
@@ -259,6 +667,31 @@ namespace jsoncons
 #define JSONCONS_ALL_TO_JSON_LAST(Prefix, P2, P3, Member, Count) \
     ajson.try_emplace(json_traits_macro_names<char_type,value_type>::Member##_str(char_type{}), aval.Member);
 
+#define JSONCONS_MEMBER_NAME_PTR(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_NAME_PTR_LAST(Prefix, P2, P3, Member, Count),
+#define JSONCONS_MEMBER_NAME_PTR_LAST(Prefix, P2, P3, Member, Count) json_traits_macro_names<CharT,value_type>::Member##_str(CharT{})
+
+#define JSONCONS_MEMBER_DECODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_DECODE_LAST(Prefix, P2, P3, Member, Count) \
+    case (num_params-Count): \
+        decode_traits_helper<CharT>::decode_member(cursor, decoder, aval.Member, ec); \
+        break;
+
+#define JSONCONS_MEMBER_RESET(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_RESET_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_RESET_LAST(Prefix, P2, P3, Member, Count) \
+    if (!found.test(num_params-Count)) decode_traits_helper<CharT>::reset_member(aval.Member, defaults.Member);
+
+#define JSONCONS_MEMBER_COUNT(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_COUNT_LAST(Prefix, P2, P3, Member, Count) \
+    if ((num_params-Count) < num_mandatory_params || encode_traits_helper<CharT>::is_present(aval.Member)) ++count;
+
+#define JSONCONS_MEMBER_ENCODE(Prefix, P2, P3, Member, Count) JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count)
+#define JSONCONS_MEMBER_ENCODE_LAST(Prefix, P2, P3, Member, Count) \
+    if ((num_params-Count) < num_mandatory_params || encode_traits_helper<CharT>::is_present(aval.Member)) \
+    { \
+        encode_traits_helper<CharT>::encode_member(json_traits_macro_names<CharT,value_type>::Member##_str(CharT{}), aval.Member, encoder, proto, ec); \
+        if (ec) return; \
+    }
+
 #define JSONCONS_MEMBER_TRAITS_BASE(AsT,ToJ,NumTemplateParams,ValueType,NumMandatoryParams1,NumMandatoryParams2, ...)  \
 namespace jsoncons \
 { \
@@ -297,6 +730,117 @@ namespace jsoncons \
             return ajson; \
         } \
     }; \
+    template <class CharT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),CharT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params = NumMandatoryParams2; \
+        static const jsoncons::detail::name_index<CharT>& member_index() \
+        { \
+            static const CharT* const names[] = {JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_NAME_PTR, ,,, __VA_ARGS__)}; \
+            static const jsoncons::detail::name_index<CharT> index(names, num_params); \
+            return index; \
+        } \
+        template <class Json,class TempAllocator> \
+        static value_type decode(basic_staj_cursor<CharT>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 std::error_code& ec) \
+        { \
+            value_type aval{}; \
+            read(cursor, decoder, aval, false, ec); \
+            return aval; \
+        } \
+        template <class Json,class TempAllocator> \
+        static void read(basic_staj_cursor<CharT>& cursor, \
+                         json_decoder<Json,TempAllocator>& decoder, \
+                         value_type& aval, bool reset_absent, \
+                         std::error_code& ec) \
+        { \
+            if (cursor.current().event_type() != staj_event_type::begin_object) \
+            { \
+                ec = conv_errc::conversion_failed; \
+                return; \
+            } \
+            const jsoncons::detail::name_index<CharT>& index = member_index(); \
+            std::bitset<num_params> found; \
+            cursor.next(ec); \
+            while (!ec && cursor.current().event_type() != staj_event_type::end_object) \
+            { \
+                if (cursor.current().event_type() != staj_event_type::key) \
+                { \
+                    ec = json_errc::expected_key; \
+                    return; \
+                } \
+                auto key = cursor.current().template get<basic_string_view<CharT>>(ec); \
+                if (ec) return; \
+                std::size_t member = index.find(key.data(), key.size()); \
+                if (member == index.npos) \
+                { \
+                    cursor.skip(ec); \
+                    continue; \
+                } \
+                cursor.next(ec); \
+                if (ec) return; \
+                switch (member) \
+                { \
+                    JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_DECODE, ,,, __VA_ARGS__) \
+                    default: \
+                        break; \
+                } \
+                if (ec) return; \
+                found.set(member); \
+                cursor.next(ec); \
+            } \
+            if (ec) return; \
+            for (std::size_t i = 0; i < num_mandatory_params; ++i) \
+            { \
+                if (!found.test(i)) \
+                { \
+                    ec = conv_errc::missing_required_member; \
+                    return; \
+                } \
+            } \
+            if (reset_absent && !found.all()) \
+            { \
+                value_type defaults{}; \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_RESET, ,,, __VA_ARGS__) \
+            } \
+        } \
+    }; \
+    template <class CharT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct decode_into_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),CharT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        template <class Json,class TempAllocator> \
+        static void decode_into(basic_staj_cursor<CharT>& cursor, \
+                                json_decoder<Json,TempAllocator>& decoder, \
+                                value_type& aval, \
+                                std::error_code& ec) \
+        { \
+            decode_traits<value_type,CharT>::read(cursor, decoder, aval, true, ec); \
+        } \
+    }; \
+    template <class CharT JSONCONS_GENERATE_TPL_PARAMS(JSONCONS_GENERATE_MORE_TPL_PARAM, NumTemplateParams)> \
+    struct encode_traits<ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams),CharT> \
+    { \
+        using value_type = ValueType JSONCONS_GENERATE_TPL_ARGS(JSONCONS_GENERATE_TPL_ARG, NumTemplateParams); \
+        constexpr static size_t num_params = JSONCONS_NARGS(__VA_ARGS__); \
+        constexpr static size_t num_mandatory_params = NumMandatoryParams2; \
+        template <class Json> \
+        static void encode(const value_type& aval, \
+                           basic_json_visitor<CharT>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) \
+        { \
+            std::size_t count = 0; \
+            JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_COUNT, ,,, __VA_ARGS__) \
+            encoder.begin_object(count, semantic_tag::none, ser_context(), ec); \
+            if (ec) return; \
+            JSONCONS_VARIADIC_REP_N(JSONCONS_MEMBER_ENCODE, ,,, __VA_ARGS__) \
+            encoder.end_object(ser_context(), ec); \
+        } \
+    }; \
 } \
   /**/
 
@@ -637,6 +1181,22 @@ namespace jsoncons \
             return std::make_pair(v,v+JSONCONS_NARGS(__VA_ARGS__)); \
         } \
         \
+        static const mapped_type* find_name(const string_view_type& s) \
+        { \
+            static const jsoncons::detail::name_index<char_type> index(get_names()); \
+            std::size_t i = index.find(s.data(), s.size()); \
+            return i == index.npos ? get_values().second : get_values().first + i; \
+        } \
+        static std::vector<const char_type*> get_names() \
+        { \
+            std::vector<const char_type*> names; \
+            for (auto p = get_values().first; p != get_values().second; ++p) \
+            { \
+                names.push_back(p->second.c_str()); \
+            } \
+            return names; \
+        } \
+        \
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_string()) return false; \
@@ -649,9 +1209,7 @@ namespace jsoncons \
             { \
                 return true; \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
+            auto it = find_name(s); \
             return it != last; \
         } \
         static value_type as(const Json& ajson) \
@@ -666,9 +1224,7 @@ namespace jsoncons \
             { \
                 return value_type(); \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
+            auto it = find_name(s); \
             if (it == last) \
             { \
                 if (s.empty()) \
@@ -738,6 +1294,22 @@ namespace jsoncons \
             return std::make_pair(v,v+JSONCONS_NARGS(__VA_ARGS__)); \
         } \
         \
+        static const mapped_type* find_name(const string_view_type& s) \
+        { \
+            static const jsoncons::detail::name_index<char_type> index(get_names()); \
+            std::size_t i = index.find(s.data(), s.size()); \
+            return i == index.npos ? get_values().second : get_values().first + i; \
+        } \
+        static std::vector<const char_type*> get_names() \
+        { \
+            std::vector<const char_type*> names; \
+            for (auto p = get_values().first; p != get_values().second; ++p) \
+            { \
+                names.push_back(p->second.c_str()); \
+            } \
+            return names; \
+        } \
+        \
         static bool is(const Json& ajson) noexcept \
         { \
             if (!ajson.is_string()) return false; \
@@ -750,9 +1322,7 @@ namespace jsoncons \
             { \
                 return true; \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
+            auto it = find_name(s); \
             return it != last; \
         } \
         static value_type as(const Json& ajson) \
@@ -767,9 +1337,7 @@ namespace jsoncons \
             { \
                 return value_type(); \
             } \
-            auto it = std::find_if(first, last, \
-                                   [&](const mapped_type& item) -> bool \
-                                   { return item.second == s; }); \
+            auto it = find_name(s); \
             if (it == last) \
             { \
                 if (s.empty()) \
@@ -1049,4 +1617,159 @@ namespace jsoncons { \
 }  \
   /**/
 
+#define JSONCONS_POLYMORPHIC_TAG_CLASS_(DerivedClass, Tag) DerivedClass
+#define JSONCONS_POLYMORPHIC_TAG_NAME_(DerivedClass, Tag) Tag
+
+#define JSONCONS_POLYMORPHIC_TAG_NAME(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_NAME_LAST(P1, P2, P3, Seq, Count),
+#define JSONCONS_POLYMORPHIC_TAG_NAME_LAST(P1, P2, P3, Seq, Count) JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_NAME_ Seq)
+
+#define JSONCONS_POLYMORPHIC_TAG_TYPEID(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_TYPEID_LAST(P1, P2, P3, Seq, Count),
+#define JSONCONS_POLYMORPHIC_TAG_TYPEID_LAST(P1, P2, P3, Seq, Count) {std::type_index(typeid(JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq))), num_classes-Count}
+
+#define JSONCONS_POLYMORPHIC_TAG_CAST(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_CAST_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_POLYMORPHIC_TAG_CAST_LAST(P1, P2, P3, Seq, Count) if (dynamic_cast<const JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq)*>(std::addressof(val)) != nullptr) return num_classes-Count;
+
+#define JSONCONS_POLYMORPHIC_TAG_IS(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_IS_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_POLYMORPHIC_TAG_IS_LAST(P1, P2, P3, Seq, Count) case (num_classes-Count): return ajson.template is<JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq)>();
+
+#define JSONCONS_POLYMORPHIC_TAG_AS(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_AS_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_POLYMORPHIC_TAG_AS_LAST(P1, P2, P3, Seq, Count) case (num_classes-Count): \
+    polymorphic_traits_helper<typename Json::char_type>::assign(ptr, ajson.template as<JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq)>()); \
+    break;
+
+#define JSONCONS_POLYMORPHIC_TAG_TO_JSON(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_TO_JSON_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_POLYMORPHIC_TAG_TO_JSON_LAST(P1, P2, P3, Seq, Count) case (num_classes-Count): \
+    return Json(dynamic_cast<const JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq)&>(val));
+
+#define JSONCONS_POLYMORPHIC_TAG_DECODE(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_DECODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_POLYMORPHIC_TAG_DECODE_LAST(P1, P2, P3, Seq, Count) case (num_classes-Count): \
+    { \
+        auto val = decode_traits<JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq),CharT>::decode(cursor, decoder, ec); \
+        if (!ec) polymorphic_traits_helper<CharT>::assign(ptr, std::move(val)); \
+        break; \
+    }
+
+#define JSONCONS_POLYMORPHIC_TAG_ENCODE(P1, P2, P3, Seq, Count) JSONCONS_POLYMORPHIC_TAG_ENCODE_LAST(P1, P2, P3, Seq, Count)
+#define JSONCONS_POLYMORPHIC_TAG_ENCODE_LAST(P1, P2, P3, Seq, Count) case (num_classes-Count): \
+    encode_traits<JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq),CharT>::encode(dynamic_cast<const JSONCONS_EXPAND(JSONCONS_POLYMORPHIC_TAG_CLASS_ Seq)&>(val), encoder, proto, ec); \
+    break;
+
+#define JSONCONS_POLYMORPHIC_TAG_POINTER_TRAITS(BaseClass, Pointer) \
+    template<class Json> \
+    struct json_type_traits<Json, Pointer<BaseClass>> { \
+        using char_type = typename Json::char_type; \
+        static std::size_t tagged_class(const Json& ajson) { \
+            const polymorphic_tag_table<char_type>& table = polymorphic_tags<BaseClass>::template table<char_type>(); \
+            if (!ajson.is_object()) return table.npos; \
+            auto it = ajson.find(table.key()); \
+            if (it == ajson.object_range().end() || !it->value().is_string()) return table.npos; \
+            return table.find(it->value().as_string_view()); \
+        } \
+        static bool is(const Json& ajson) noexcept { \
+            std::size_t i = tagged_class(ajson); \
+            return i != polymorphic_tag_table<char_type>::npos && polymorphic_tags<BaseClass>::is_class(i, ajson); \
+        } \
+        static Pointer<BaseClass> as(const Json& ajson) { \
+            Pointer<BaseClass> ptr; \
+            std::size_t i = tagged_class(ajson); \
+            if (i != polymorphic_tag_table<char_type>::npos) polymorphic_tags<BaseClass>::as_class(i, ajson, ptr); \
+            return ptr; \
+        } \
+        static Json to_json(const Pointer<BaseClass>& ptr) { \
+            if (ptr.get() == nullptr) {return Json::null();} \
+            std::size_t i = polymorphic_tags<BaseClass>::class_of(*ptr); \
+            if (i == polymorphic_tag_table<char_type>::npos) {return Json::null();} \
+            const polymorphic_tag_table<char_type>& table = polymorphic_tags<BaseClass>::template table<char_type>(); \
+            Json j = polymorphic_tags<BaseClass>::template to_json_class<Json>(i, *ptr); \
+            j.try_emplace(table.key(), table.tag(i)); \
+            return j; \
+        } \
+    }; \
+    template <class CharT> \
+    struct decode_traits<Pointer<BaseClass>,CharT> { \
+        template <class Json,class TempAllocator> \
+        static Pointer<BaseClass> decode(basic_staj_cursor<CharT>& cursor, \
+                                         json_decoder<Json,TempAllocator>& decoder, \
+                                         std::error_code& ec) { \
+            return polymorphic_traits_helper<CharT>::template decode<Pointer<BaseClass>>(cursor, decoder, ec); \
+        } \
+    }; \
+    template <class CharT> \
+    struct encode_traits<Pointer<BaseClass>,CharT> { \
+        template <class Json> \
+        static void encode(const Pointer<BaseClass>& ptr, \
+                           basic_json_visitor<CharT>& encoder, \
+                           const Json& proto, \
+                           std::error_code& ec) { \
+            polymorphic_traits_helper<CharT>::encode(ptr, encoder, proto, ec); \
+        } \
+    }; \
+  /**/
+
+// Declares a discriminator key whose string value tags each derived class, so that
+// decoding reads the tag once and dispatches to that class, and encoding looks up
+// the tag by the typeid of the object
+#define JSONCONS_POLYMORPHIC_TAG_TRAITS(BaseClass, Key, ...)  \
+namespace jsoncons { \
+    template <> \
+    struct polymorphic_tags<BaseClass> { \
+        constexpr static std::size_t num_classes = JSONCONS_NARGS(__VA_ARGS__); \
+        template <class CharT> \
+        static const polymorphic_tag_table<CharT>& table() { \
+            static const char* const tags[] = {JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_NAME,,,, __VA_ARGS__)}; \
+            static const polymorphic_tag_table<CharT> tag_table(Key, tags, num_classes); \
+            return tag_table; \
+        } \
+        static std::size_t class_of(const BaseClass& val) { \
+            static const std::unordered_map<std::type_index,std::size_t> classes = {JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_TYPEID,,,, __VA_ARGS__)}; \
+            auto it = classes.find(std::type_index(typeid(val))); \
+            if (it != classes.end()) return it->second; \
+            JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_CAST,,,, __VA_ARGS__) \
+            return polymorphic_tag_table<char>::npos; \
+        } \
+        template <class Json> \
+        static bool is_class(std::size_t i, const Json& ajson) { \
+            switch (i) { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_IS,,,, __VA_ARGS__) \
+                default: return false; \
+            } \
+        } \
+        template <class Json,class Pointer> \
+        static void as_class(std::size_t i, const Json& ajson, Pointer& ptr) { \
+            switch (i) { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_AS,,,, __VA_ARGS__) \
+                default: break; \
+            } \
+        } \
+        template <class Json> \
+        static Json to_json_class(std::size_t i, const BaseClass& val) { \
+            switch (i) { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_TO_JSON,,,, __VA_ARGS__) \
+                default: return Json::null(); \
+            } \
+        } \
+        template <class CharT,class Json,class TempAllocator,class Pointer> \
+        static void decode_class(std::size_t i, basic_staj_cursor<CharT>& cursor, \
+                                 json_decoder<Json,TempAllocator>& decoder, \
+                                 Pointer& ptr, std::error_code& ec) { \
+            switch (i) { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_DECODE,,,, __VA_ARGS__) \
+                default: break; \
+            } \
+        } \
+        template <class CharT,class Json> \
+        static void encode_class(std::size_t i, const BaseClass& val, \
+                                 basic_json_visitor<CharT>& encoder, \
+                                 const Json& proto, std::error_code& ec) { \
+            switch (i) { \
+                JSONCONS_VARIADIC_REP_N(JSONCONS_POLYMORPHIC_TAG_ENCODE,,,, __VA_ARGS__) \
+                default: break; \
+            } \
+        } \
+    }; \
+    JSONCONS_POLYMORPHIC_TAG_POINTER_TRAITS(BaseClass, std::shared_ptr) \
+    JSONCONS_POLYMORPHIC_TAG_POINTER_TRAITS(BaseClass, std::unique_ptr) \
+}  \
+  /**/
+
 #endif
@@ -8,6 +8,8 @@
 #define JSONCONS_JSON_TYPE_HPP
 
 #include <ostream>
+#include <cstdint>
+#include <type_traits> // std::integral_constant
 #include <jsoncons/config/jsoncons_config.hpp>
 
 namespace jsoncons {
@@ -110,7 +112,9 @@ namespace jsoncons {
         array_value = 0x09,
         empty_object_value = 0x0a,
         object_value = 0x0b,
-        json_const_pointer = 0x0c
+        json_const_pointer = 0x0c,
+        borrowed_string_value = 0x0d,
+        typed_array_value = 0x0e
     };
 
     template <class CharT>
@@ -129,6 +133,8 @@ namespace jsoncons {
         JSONCONS_CSTRING(CharT,empty_object_value,'e','m','p','t','y',' ','o','b','j','e','c','t')
         JSONCONS_CSTRING(CharT,object_value,'o','b','j','e','c','t')
         JSONCONS_CSTRING(CharT,json_const_pointer,'j','s','o','n',' ','c','o','n','s','t',' ','p','o','i','n','t','e','r')
+        JSONCONS_CSTRING(CharT,borrowed_string_value,'b','o','r','r','o','w','e','d',' ','s','t','r','i','n','g')
+        JSONCONS_CSTRING(CharT,typed_array_value,'t','y','p','e','d',' ','a','r','r','a','y')
 
         switch (storage)
         {
@@ -197,10 +203,108 @@ namespace jsoncons {
                 os << json_const_pointer;
                 break;
             }
+            case storage_kind::borrowed_string_value:
+            {
+                os << borrowed_string_value;
+                break;
+            }
+            case storage_kind::typed_array_value:
+            {
+                os << typed_array_value;
+                break;
+            }
         }
         return os;
     }
 
+    enum class typed_array_type{uint8_value=1,uint16_value,uint32_value,uint64_value,
+                                int8_value,int16_value,int32_value,int64_value, 
+                                half_value, float_value,double_value};
+
+    template <class CharT>
+    std::basic_ostream<CharT>& operator<<(std::basic_ostream<CharT>& os, typed_array_type type)
+    {
+        JSONCONS_CSTRING(CharT,uint8_value,'u','i','n','t','8')
+        JSONCONS_CSTRING(CharT,uint16_value,'u','i','n','t','1','6')
+        JSONCONS_CSTRING(CharT,uint32_value,'u','i','n','t','3','2')
+        JSONCONS_CSTRING(CharT,uint64_value,'u','i','n','t','6','4')
+        JSONCONS_CSTRING(CharT,int8_value,'i','n','t','8')
+        JSONCONS_CSTRING(CharT,int16_value,'i','n','t','1','6')
+        JSONCONS_CSTRING(CharT,int32_value,'i','n','t','3','2')
+        JSONCONS_CSTRING(CharT,int64_value,'i','n','t','6','4')
+        JSONCONS_CSTRING(CharT,half_value,'h','a','l','f')
+        JSONCONS_CSTRING(CharT,float_value,'f','l','o','a','t')
+        JSONCONS_CSTRING(CharT,double_value,'d','o','u','b','l','e')
+
+        switch (type)
+        {
+            case typed_array_type::uint8_value:
+                os << uint8_value;
+                break;
+            case typed_array_type::uint16_value:
+                os << uint16_value;
+                break;
+            case typed_array_type::uint32_value:
+                os << uint32_value;
+                break;
+            case typed_array_type::uint64_value:
+                os << uint64_value;
+                break;
+            case typed_array_type::int8_value:
+                os << int8_value;
+                break;
+            case typed_array_type::int16_value:
+                os << int16_value;
+                break;
+            case typed_array_type::int32_value:
+                os << int32_value;
+                break;
+            case typed_array_type::int64_value:
+                os << int64_value;
+                break;
+            case typed_array_type::half_value:
+                os << half_value;
+                break;
+            case typed_array_type::float_value:
+                os << float_value;
+                break;
+            case typed_array_type::double_value:
+                os << double_value;
+                break;
+        }
+        return os;
+    }
+
+namespace detail {
+
+    // Maps an element type to its typed array type, half precision elements are 
+    // held as uint16_t and identified separately with half_arg
+    template <class T>
+    struct typed_array_type_of {};
+
+    template <>
+    struct typed_array_type_of<uint8_t> : std::integral_constant<typed_array_type,typed_array_type::uint8_value> {};
+    template <>
+    struct typed_array_type_of<uint16_t> : std::integral_constant<typed_array_type,typed_array_type::uint16_value> {};
+    template <>
+    struct typed_array_type_of<uint32_t> : std::integral_constant<typed_array_type,typed_array_type::uint32_value> {};
+    template <>
+    struct typed_array_type_of<uint64_t> : std::integral_constant<typed_array_type,typed_array_type::uint64_value> {};
+    template <>
+    struct typed_array_type_of<int8_t> : std::integral_constant<typed_array_type,typed_array_type::int8_value> {};
+    template <>
+    struct typed_array_type_of<int16_t> : std::integral_constant<typed_array_type,typed_array_type::int16_value> {};
+    template <>
+    struct typed_array_type_of<int32_t> : std::integral_constant<typed_array_type,typed_array_type::int32_value> {};
+    template <>
+    struct typed_array_type_of<int64_t> : std::integral_constant<typed_array_type,typed_array_type::int64_value> {};
+    template <>
+    struct typed_array_type_of<float> : std::integral_constant<typed_array_type,typed_array_type::float_value> {};
+    template <>
+    struct typed_array_type_of<double> : std::integral_constant<typed_array_type,typed_array_type::double_value> {};
+
+} // namespace detail
+
 } // jsoncons
 
 #endif
@@ -126,6 +126,67 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
         !is_json_type_traits_unspecialized<Json,typename std::iterator_traits<typename T::iterator>::value_type>::value
     >::type> : std::true_type {};
 
+    // typed arrays
+
+    template <class T>
+    using typed_array_type_of_t = decltype(typed_array_type_of<T>::value);
+
+    template <class Container>
+    using container_resize_t = decltype(std::declval<Container&>().resize(std::size_t()));
+
+    template <class Json, class T>
+    bool typed_elements_are(const Json& j) noexcept
+    {
+        for (std::size_t i = 0; i < j.size(); ++i)
+        {
+            if (!j.typed_element(i).template is<T>())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <class Json, class Container, class Enable = void>
+    struct typed_array_copier
+    {
+        static void copy(const Json& j, Container& result)
+        {
+            for (std::size_t i = 0; i < j.size(); ++i)
+            {
+                result.push_back(j.typed_element(i).template as<typename Container::value_type>());
+            }
+        }
+    };
+
+    // Contiguous containers of the element type are filled with a single copy
+    template <class Json, class Container>
+    struct typed_array_copier<Json, Container,
+        typename std::enable_if<is_detected<typed_array_type_of_t,typename Container::value_type>::value &&
+                                has_data_exact<typename Container::value_type*,Container>::value &&
+                                is_detected<container_resize_t,Container>::value
+    >::type>
+    {
+        using value_type = typename Container::value_type;
+
+        static void copy(const Json& j, Container& result)
+        {
+            if (j.typed_element_type() == typed_array_type_of<value_type>::value)
+            {
+                auto s = j.template as_span<value_type>();
+                result.resize(s.size());
+                if (s.size() > 0)
+                {
+                    std::memcpy(result.data(), s.data(), s.size()*sizeof(value_type));
+                }
+            }
+            else
+            {
+                typed_array_copier<Json,Container,std::false_type>::copy(j, result);
+            }
+        }
+    };
+
 } // namespace detail
 
     // is_json_type_traits_specialized
@@ -145,7 +206,8 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
-            return j.is_string();
+            // Borrowed strings are not null terminated, use as<string_view>
+            return j.is_string() && j.storage() != storage_kind::borrowed_string_value;
         }
         static const char_type* as(const Json& j)
         {
@@ -464,6 +526,10 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
+            if (j.is_typed_array())
+            {
+                return jsoncons::detail::typed_elements_are<Json,value_type>(j);
+            }
             bool result = j.is_array();
             if (result)
             {
@@ -485,7 +551,14 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
         static typename std::enable_if<!jsoncons::detail::is_byte<typename Container::value_type>::value,Container>::type
         as(const Json& j)
         {
-            if (j.is_array())
+            if (j.is_typed_array())
+            {
+                T result;
+                visit_reserve_(typename std::integral_constant<bool, jsoncons::detail::has_reserve<T>::value>::type(),result,j.size());
+                jsoncons::detail::typed_array_copier<Json,T>::copy(j, result);
+                return result;
+            }
+            else if (j.is_array())
             {
                 T result;
                 visit_reserve_(typename std::integral_constant<bool, jsoncons::detail::has_reserve<T>::value>::type(),result,j.size());
@@ -510,7 +583,14 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
         {
             converter<T> convert;
             std::error_code ec;
-            if (j.is_array())
+            if (j.is_typed_array())
+            {
+                T result;
+                visit_reserve_(typename std::integral_constant<bool, jsoncons::detail::has_reserve<T>::value>::type(),result,j.size());
+                jsoncons::detail::typed_array_copier<Json,T>::copy(j, result);
+                return result;
+            }
+            else if (j.is_array())
             {
                 T result;
                 visit_reserve_(typename std::integral_constant<bool, jsoncons::detail::has_reserve<T>::value>::type(),result,j.size());
@@ -617,6 +697,10 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
+            if (j.is_typed_array())
+            {
+                return jsoncons::detail::typed_elements_are<Json,value_type>(j);
+            }
             bool result = j.is_array();
             if (result)
             {
@@ -634,7 +718,16 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static T as(const Json& j)
         {
-            if (j.is_array())
+            if (j.is_typed_array())
+            {
+                T result;
+                for (std::size_t i = 0; i < j.size(); ++i)
+                {
+                    result.insert(j.typed_element(i).template as<value_type>());
+                }
+                return result;
+            }
+            else if (j.is_array())
             {
                 T result;
                 for (const auto& item : j.array_range())
@@ -694,6 +787,10 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
+            if (j.is_typed_array())
+            {
+                return jsoncons::detail::typed_elements_are<Json,value_type>(j);
+            }
             bool result = j.is_array();
             if (result)
             {
@@ -711,7 +808,16 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static T as(const Json& j)
         {
-            if (j.is_array())
+            if (j.is_typed_array())
+            {
+                T result;
+                for (std::size_t i = j.size(); i > 0; --i)
+                {
+                    result.push_front(j.typed_element(i-1).template as<value_type>());
+                }
+                return result;
+            }
+            else if (j.is_array())
             {
                 T result;
 
@@ -770,6 +876,10 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
+            if (j.is_typed_array())
+            {
+                return j.size() == N && jsoncons::detail::typed_elements_are<Json,value_type>(j);
+            }
             bool result = j.is_array() && j.size() == N;
             if (result)
             {
@@ -792,6 +902,14 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
             {
                 JSONCONS_THROW(conv_error(conv_errc::not_array));
             }
+            if (j.is_typed_array())
+            {
+                for (std::size_t i = 0; i < N; i++)
+                {
+                    buff[i] = j.typed_element(i).template as<E>();
+                }
+                return buff;
+            }
             for (std::size_t i = 0; i < N; i++)
             {
                 buff[i] = j[i].template as<E>();
@@ -1266,6 +1384,10 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
 
         static bool is(const Json& j) noexcept
         {
+            if (j.is_typed_array())
+            {
+                return jsoncons::detail::typed_elements_are<Json,T>(j);
+            }
             bool result = j.is_array();
             if (result)
             {
@@ -1288,7 +1410,7 @@ has_can_convert = jsoncons::detail::is_detected<traits_can_convert_t, Json, T>;
                 std::valarray<T> v(j.size());
                 for (std::size_t i = 0; i < j.size(); ++i)
                 {
-                    v[i] = j[i].template as<T>();
+                    v[i] = j.is_typed_array() ? j.typed_element(i).template as<T>() : j[i].template as<T>();
                 }
                 return v;
             }
@@ -843,6 +843,21 @@ namespace jsoncons {
             destination_ = std::addressof(dest);
         }
 
+        // The containers entered and not yet ended, saved and restored by cursor bookmarks
+        using level_stack_type = std::vector<level,level_allocator_type>;
+
+        const level_stack_type& level_stack() const
+        {
+            return level_stack_;
+        }
+
+        void level_stack(const level_stack_type& levels)
+        {
+            level_stack_ = levels;
+            key_.clear();
+            key_buffer_.clear();
+        }
+
     private:
         void visit_flush() override
         {
@@ -0,0 +1,839 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PERSISTENT_JSON_HPP
+#define JSONCONS_PERSISTENT_JSON_HPP
+
+#include <cstdint>
+#include <memory> // std::shared_ptr, std::allocate_shared
+#include <ostream>
+#include <string>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    inline
+    uint32_t popcount32(uint32_t x) noexcept
+    {
+        x = x - ((x >> 1) & 0x55555555u);
+        x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+        return (((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+    }
+
+} // namespace detail
+
+    // persistent_json
+
+    // An immutable JSON value. Arrays are held in a 32-way persistent vector trie,
+    // objects in a hash array mapped trie (HAMT). Modifications return a new value
+    // that shares all untouched nodes with the original, copies are O(1).
+    template <class Json>
+    class persistent_json
+    {
+    public:
+        using basic_json_type = Json;
+        using char_type = typename Json::char_type;
+        using string_view_type = typename Json::string_view_type;
+        using allocator_type = typename Json::allocator_type;
+        using char_allocator_type = typename std::allocator_traits<allocator_type>:: template rebind_alloc<char_type>;
+        using key_type = std::basic_string<char_type,std::char_traits<char_type>,char_allocator_type>;
+    private:
+        static constexpr unsigned bits = 5;
+        static constexpr std::size_t width = std::size_t(1) << bits;
+        static constexpr std::size_t mask = width - 1;
+        static constexpr unsigned hash_bits = 32;
+
+        enum class value_kind : uint8_t {scalar, array, object};
+
+        // persistent vector
+
+        // Nodes hold persistent_json values, so are defined after the class is complete
+
+        struct vector_node;
+        using vector_node_ptr = std::shared_ptr<const vector_node>;
+
+        // hash array mapped trie
+
+        struct map_entry;
+        struct map_node;
+        using map_node_ptr = std::shared_ptr<const map_node>;
+
+        value_kind kind_;
+        Json scalar_;
+        std::shared_ptr<const vector_node> vector_root_;
+        std::shared_ptr<const map_node> map_root_;
+        std::size_t size_;
+        unsigned shift_;
+        allocator_type alloc_;
+
+    public:
+        persistent_json()
+            : kind_(value_kind::scalar), scalar_(), size_(0), shift_(0), alloc_()
+        {
+        }
+
+        persistent_json(const Json& val)
+            : persistent_json(val, val.get_allocator())
+        {
+        }
+
+        persistent_json(const Json& val, const allocator_type& alloc)
+            : kind_(value_kind::scalar), scalar_(), size_(0), shift_(0), alloc_(alloc)
+        {
+            switch (val.type())
+            {
+                case json_type::array_value:
+                {
+                    persistent_json result = make_array(alloc);
+                    if (val.is_typed_array())
+                    {
+                        for (std::size_t i = 0; i < val.size(); ++i)
+                        {
+                            result = result.push_back(persistent_json(val.typed_element(i), alloc));
+                        }
+                    }
+                    else
+                    {
+                        for (const auto& item : val.array_range())
+                        {
+                            result = result.push_back(persistent_json(item, alloc));
+                        }
+                    }
+                    swap(result);
+                    break;
+                }
+                case json_type::object_value:
+                {
+                    persistent_json result = make_object(alloc);
+                    for (const auto& member : val.object_range())
+                    {
+                        result = result.with(string_view_type(member.key().data(), member.key().size()),
+                                             persistent_json(member.value(), alloc));
+                    }
+                    swap(result);
+                    break;
+                }
+                default:
+                    scalar_ = Json(val, alloc);
+                    break;
+            }
+        }
+
+        persistent_json(const persistent_json&) = default;
+        persistent_json(persistent_json&&) = default;
+        persistent_json& operator=(const persistent_json&) = default;
+        persistent_json& operator=(persistent_json&&) = default;
+
+        static persistent_json make_array(const allocator_type& alloc = allocator_type())
+        {
+            persistent_json result;
+            result.kind_ = value_kind::array;
+            result.alloc_ = alloc;
+            return result;
+        }
+
+        static persistent_json make_object(const allocator_type& alloc = allocator_type())
+        {
+            persistent_json result;
+            result.kind_ = value_kind::object;
+            result.alloc_ = alloc;
+            return result;
+        }
+
+        void swap(persistent_json& other) noexcept
+        {
+            std::swap(kind_, other.kind_);
+            scalar_.swap(other.scalar_);
+            vector_root_.swap(other.vector_root_);
+            map_root_.swap(other.map_root_);
+            std::swap(size_, other.size_);
+            std::swap(shift_, other.shift_);
+            std::swap(alloc_, other.alloc_);
+        }
+
+        json_type type() const
+        {
+            switch (kind_)
+            {
+                case value_kind::array:
+                    return json_type::array_value;
+                case value_kind::object:
+                    return json_type::object_value;
+                default:
+                    return scalar_.type();
+            }
+        }
+
+        bool is_array() const noexcept
+        {
+            return kind_ == value_kind::array;
+        }
+
+        bool is_object() const noexcept
+        {
+            return kind_ == value_kind::object;
+        }
+
+        // Returns the number of elements or members, or zero for other values
+        std::size_t size() const noexcept
+        {
+            return kind_ == value_kind::scalar ? 0 : size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return kind_ == value_kind::scalar ? scalar_.empty() : size_ == 0;
+        }
+
+        allocator_type get_allocator() const
+        {
+            return alloc_;
+        }
+
+        // Returns the value of a string, number, boolean or null
+        const Json& scalar() const
+        {
+            if (kind_ != value_kind::scalar)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not a scalar value"));
+            }
+            return scalar_;
+        }
+
+        template <class T, class... Args>
+        T as(Args&&... args) const
+        {
+            return kind_ == value_kind::scalar ? scalar_.template as<T>(std::forward<Args>(args)...)
+                                               : to_json().template as<T>(std::forward<Args>(args)...);
+        }
+
+        Json to_json() const
+        {
+            return to_json(alloc_);
+        }
+
+        Json to_json(const allocator_type& alloc) const
+        {
+            switch (kind_)
+            {
+                case value_kind::array:
+                {
+                    Json result(json_array_arg, semantic_tag::none, alloc);
+                    result.reserve(size_);
+                    for_each_element([&](const persistent_json& item){result.push_back(item.to_json(alloc));});
+                    return result;
+                }
+                case value_kind::object:
+                {
+                    Json result(json_object_arg, semantic_tag::none, alloc);
+                    result.reserve(size_);
+                    for_each_member([&](const string_view_type& key, const persistent_json& value){result.try_emplace(key, value.to_json(alloc));});
+                    return result;
+                }
+                default:
+                    return Json(scalar_, alloc);
+            }
+        }
+
+        // Arrays
+
+        const persistent_json& operator[](std::size_t i) const
+        {
+            return at(i);
+        }
+
+        const persistent_json& at(std::size_t i) const
+        {
+            if (kind_ != value_kind::array)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            if (i >= size_)
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            const vector_node* node = vector_root_.get();
+            for (unsigned level = shift_; level > 0; level -= bits)
+            {
+                node = node->children[(i >> level) & mask].get();
+            }
+            return node->values[i & mask];
+        }
+
+        // Returns a copy of this array with the element at position i replaced by value
+        persistent_json with(std::size_t i, const persistent_json& value) const
+        {
+            if (kind_ != value_kind::array)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            if (i >= size_)
+            {
+                JSONCONS_THROW(json_runtime_error<std::out_of_range>("Invalid array subscript"));
+            }
+            persistent_json result(*this);
+            result.vector_root_ = assoc_vector(vector_root_.get(), shift_, i, value);
+            return result;
+        }
+
+        // Returns a copy of this array with value appended
+        persistent_json push_back(const persistent_json& value) const
+        {
+            if (kind_ != value_kind::array)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an array"));
+            }
+            persistent_json result(*this);
+            if (!vector_root_)
+            {
+                auto leaf = std::allocate_shared<vector_node>(alloc_, alloc_);
+                leaf->values.push_back(value);
+                result.vector_root_ = leaf;
+                result.shift_ = 0;
+            }
+            else if (size_ == (std::size_t(1) << (shift_ + bits)))
+            {
+                auto root = std::allocate_shared<vector_node>(alloc_, alloc_);
+                root->children.push_back(vector_root_);
+                root->children.push_back(new_path(shift_, value));
+                result.vector_root_ = root;
+                result.shift_ = shift_ + bits;
+            }
+            else
+            {
+                result.vector_root_ = push_back_vector(vector_root_.get(), shift_, size_, value);
+            }
+            ++result.size_;
+            return result;
+        }
+
+        template <class F>
+        void for_each_element(F f) const
+        {
+            if (kind_ == value_kind::array && vector_root_)
+            {
+                for_each_element(vector_root_.get(), shift_, f);
+            }
+        }
+
+        // Objects
+
+        bool contains(const string_view_type& key) const
+        {
+            return find(key) != nullptr;
+        }
+
+        // Returns a pointer to the value of the member named key, or null if there is no such member
+        const persistent_json* find(const string_view_type& key) const
+        {
+            if (kind_ != value_kind::object || !map_root_)
+            {
+                return nullptr;
+            }
+            uint32_t hash = hash_key(key);
+            const map_node* node = map_root_.get();
+            for (unsigned shift = 0; ; shift += bits)
+            {
+                if (shift >= hash_bits)
+                {
+                    for (const auto& entry : node->entries)
+                    {
+                        if (string_view_type(entry.key.data(), entry.key.size()) == key)
+                        {
+                            return &entry.value;
+                        }
+                    }
+                    return nullptr;
+                }
+                uint32_t bit = uint32_t(1) << ((hash >> shift) & mask);
+                if (!(node->bitmap & bit))
+                {
+                    return nullptr;
+                }
+                const map_entry& entry = node->entries[detail::popcount32(node->bitmap & (bit - 1))];
+                if (entry.is_leaf())
+                {
+                    return string_view_type(entry.key.data(), entry.key.size()) == key ? &entry.value : nullptr;
+                }
+                node = entry.child.get();
+            }
+        }
+
+        const persistent_json& operator[](const string_view_type& key) const
+        {
+            return at(key);
+        }
+
+        const persistent_json& at(const string_view_type& key) const
+        {
+            if (kind_ != value_kind::object)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            const persistent_json* p = find(key);
+            if (p == nullptr)
+            {
+                JSONCONS_THROW(key_not_found(key.data(),key.length()));
+            }
+            return *p;
+        }
+
+        // Returns a copy of this object with the member named key set to value
+        persistent_json with(const string_view_type& key, const persistent_json& value) const
+        {
+            if (kind_ != value_kind::object)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            persistent_json result(*this);
+            bool added = false;
+            result.map_root_ = assoc_map(map_root_.get(), 0, hash_key(key), key, value, added);
+            if (added)
+            {
+                ++result.size_;
+            }
+            return result;
+        }
+
+        // Returns a copy of this object without the member named key
+        persistent_json without(const string_view_type& key) const
+        {
+            if (kind_ != value_kind::object)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Not an object"));
+            }
+            if (!map_root_)
+            {
+                return *this;
+            }
+            bool removed = false;
+            map_node_ptr root = dissoc_map(map_root_, 0, hash_key(key), key, removed);
+            if (!removed)
+            {
+                return *this;
+            }
+            persistent_json result(*this);
+            result.map_root_ = root;
+            --result.size_;
+            return result;
+        }
+
+        // Calls f(key, value) for each member, in an unspecified order
+        template <class F>
+        void for_each_member(F f) const
+        {
+            if (kind_ == value_kind::object && map_root_)
+            {
+                for_each_member(map_root_.get(), f);
+            }
+        }
+
+        // Returns true if this value and other share their root node, a copy shares
+        // its root with the original
+        bool shares_root_with(const persistent_json& other) const noexcept
+        {
+            switch (kind_)
+            {
+                case value_kind::array:
+                    return other.kind_ == value_kind::array && vector_root_ == other.vector_root_;
+                case value_kind::object:
+                    return other.kind_ == value_kind::object && map_root_ == other.map_root_;
+                default:
+                    return false;
+            }
+        }
+
+        friend bool operator==(const persistent_json& lhs, const persistent_json& rhs)
+        {
+            if (lhs.kind_ != rhs.kind_)
+            {
+                return false;
+            }
+            switch (lhs.kind_)
+            {
+                case value_kind::array:
+                {
+                    if (lhs.vector_root_ == rhs.vector_root_)
+                    {
+                        return true;
+                    }
+                    if (lhs.size_ != rhs.size_)
+                    {
+                        return false;
+                    }
+                    for (std::size_t i = 0; i < lhs.size_; ++i)
+                    {
+                        if (!(lhs.at(i) == rhs.at(i)))
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+                case value_kind::object:
+                {
+                    if (lhs.map_root_ == rhs.map_root_)
+                    {
+                        return true;
+                    }
+                    if (lhs.size_ != rhs.size_)
+                    {
+                        return false;
+                    }
+                    bool equal = true;
+                    lhs.for_each_member([&](const string_view_type& key, const persistent_json& value)
+                    {
+                        if (equal)
+                        {
+                            const persistent_json* p = rhs.find(key);
+                            equal = p != nullptr && *p == value;
+                        }
+                    });
+                    return equal;
+                }
+                default:
+                    return lhs.scalar_ == rhs.scalar_;
+            }
+        }
+
+        friend bool operator!=(const persistent_json& lhs, const persistent_json& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend std::basic_ostream<char_type>& operator<<(std::basic_ostream<char_type>& os, const persistent_json& o)
+        {
+            o.to_json().dump(os);
+            return os;
+        }
+
+    private:
+        static uint32_t hash_key(const string_view_type& key) noexcept
+        {
+            // FNV-1a
+            uint32_t hash = 2166136261u;
+            for (auto c : key)
+            {
+                hash ^= static_cast<uint32_t>(c);
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        vector_node_ptr new_path(unsigned level, const persistent_json& value) const
+        {
+            auto node = std::allocate_shared<vector_node>(alloc_, alloc_);
+            if (level == 0)
+            {
+                node->values.push_back(value);
+            }
+            else
+            {
+                node->children.push_back(new_path(level - bits, value));
+            }
+            return node;
+        }
+
+        vector_node_ptr push_back_vector(const vector_node* node, unsigned level, std::size_t index, const persistent_json& value) const
+        {
+            auto copy = std::allocate_shared<vector_node>(alloc_, *node);
+            if (level == 0)
+            {
+                copy->values.push_back(value);
+            }
+            else
+            {
+                std::size_t i = (index >> level) & mask;
+                if (i < copy->children.size())
+                {
+                    copy->children[i] = push_back_vector(copy->children[i].get(), level - bits, index, value);
+                }
+                else
+                {
+                    copy->children.push_back(new_path(level - bits, value));
+                }
+            }
+            return copy;
+        }
+
+        vector_node_ptr assoc_vector(const vector_node* node, unsigned level, std::size_t index, const persistent_json& value) const
+        {
+            auto copy = std::allocate_shared<vector_node>(alloc_, *node);
+            if (level == 0)
+            {
+                copy->values[index & mask] = value;
+            }
+            else
+            {
+                std::size_t i = (index >> level) & mask;
+                copy->children[i] = assoc_vector(copy->children[i].get(), level - bits, index, value);
+            }
+            return copy;
+        }
+
+        template <class F>
+        static void for_each_element(const vector_node* node, unsigned level, F& f)
+        {
+            if (level == 0)
+            {
+                for (const auto& value : node->values)
+                {
+                    f(value);
+                }
+            }
+            else
+            {
+                for (const auto& child : node->children)
+                {
+                    for_each_element(child.get(), level - bits, f);
+                }
+            }
+        }
+
+        map_node_ptr make_pair_node(unsigned shift, const map_entry& a, uint32_t hash_a, const map_entry& b, uint32_t hash_b) const
+        {
+            auto node = std::allocate_shared<map_node>(alloc_, alloc_);
+            if (shift >= hash_bits)
+            {
+                node->entries.push_back(a);
+                node->entries.push_back(b);
+                return node;
+            }
+            uint32_t i = (hash_a >> shift) & mask;
+            uint32_t j = (hash_b >> shift) & mask;
+            if (i == j)
+            {
+                node->bitmap = uint32_t(1) << i;
+                node->entries.emplace_back(make_pair_node(shift + bits, a, hash_a, b, hash_b), alloc_);
+            }
+            else
+            {
+                node->bitmap = (uint32_t(1) << i) | (uint32_t(1) << j);
+                if (i < j)
+                {
+                    node->entries.push_back(a);
+                    node->entries.push_back(b);
+                }
+                else
+                {
+                    node->entries.push_back(b);
+                    node->entries.push_back(a);
+                }
+            }
+            return node;
+        }
+
+        map_node_ptr assoc_map(const map_node* node, unsigned shift, uint32_t hash,
+                               const string_view_type& key, const persistent_json& value, bool& added) const
+        {
+            if (node == nullptr)
+            {
+                auto leaf = std::allocate_shared<map_node>(alloc_, alloc_);
+                leaf->entries.emplace_back(key_type(key.data(), key.size(), char_allocator_type(alloc_)), value);
+                if (shift < hash_bits)
+                {
+                    leaf->bitmap = uint32_t(1) << ((hash >> shift) & mask);
+                }
+                added = true;
+                return leaf;
+            }
+            auto copy = std::allocate_shared<map_node>(alloc_, *node);
+            if (shift >= hash_bits)
+            {
+                for (auto& entry : copy->entries)
+                {
+                    if (string_view_type(entry.key.data(), entry.key.size()) == key)
+                    {
+                        entry.value = value;
+                        return copy;
+                    }
+                }
+                copy->entries.emplace_back(key_type(key.data(), key.size(), char_allocator_type(alloc_)), value);
+                added = true;
+                return copy;
+            }
+            uint32_t bit = uint32_t(1) << ((hash >> shift) & mask);
+            std::size_t index = detail::popcount32(copy->bitmap & (bit - 1));
+            if (!(copy->bitmap & bit))
+            {
+                copy->bitmap |= bit;
+                copy->entries.insert(copy->entries.begin() + index,
+                                     map_entry(key_type(key.data(), key.size(), char_allocator_type(alloc_)), value));
+                added = true;
+                return copy;
+            }
+            map_entry& entry = copy->entries[index];
+            if (entry.is_leaf())
+            {
+                if (string_view_type(entry.key.data(), entry.key.size()) == key)
+                {
+                    entry.value = value;
+                }
+                else
+                {
+                    map_entry leaf(key_type(key.data(), key.size(), char_allocator_type(alloc_)), value);
+                    uint32_t other_hash = hash_key(string_view_type(entry.key.data(), entry.key.size()));
+                    entry = map_entry(make_pair_node(shift + bits, entry, other_hash, leaf, hash), alloc_);
+                    added = true;
+                }
+            }
+            else
+            {
+                entry.child = assoc_map(entry.child.get(), shift + bits, hash, key, value, added);
+            }
+            return copy;
+        }
+
+        // Returns null if the resulting node would be empty
+        map_node_ptr dissoc_map(const map_node_ptr& node, unsigned shift, uint32_t hash,
+                                const string_view_type& key, bool& removed) const
+        {
+            if (shift >= hash_bits)
+            {
+                for (std::size_t i = 0; i < node->entries.size(); ++i)
+                {
+                    if (string_view_type(node->entries[i].key.data(), node->entries[i].key.size()) == key)
+                    {
+                        removed = true;
+                        if (node->entries.size() == 1)
+                        {
+                            return map_node_ptr();
+                        }
+                        auto copy = std::allocate_shared<map_node>(alloc_, *node);
+                        copy->entries.erase(copy->entries.begin() + i);
+                        return copy;
+                    }
+                }
+                return node;
+            }
+            uint32_t bit = uint32_t(1) << ((hash >> shift) & mask);
+            if (!(node->bitmap & bit))
+            {
+                return node;
+            }
+            std::size_t index = detail::popcount32(node->bitmap & (bit - 1));
+            const map_entry& entry = node->entries[index];
+            if (entry.is_leaf())
+            {
+                if (string_view_type(entry.key.data(), entry.key.size()) != key)
+                {
+                    return node;
+                }
+                removed = true;
+                if (node->entries.size() == 1)
+                {
+                    return map_node_ptr();
+                }
+                auto copy = std::allocate_shared<map_node>(alloc_, *node);
+                copy->bitmap &= ~bit;
+                copy->entries.erase(copy->entries.begin() + index);
+                return copy;
+            }
+            map_node_ptr child = dissoc_map(entry.child, shift + bits, hash, key, removed);
+            if (child == entry.child)
+            {
+                return node;
+            }
+            auto copy = std::allocate_shared<map_node>(alloc_, *node);
+            if (!child)
+            {
+                copy->bitmap &= ~bit;
+                copy->entries.erase(copy->entries.begin() + index);
+                if (copy->entries.empty())
+                {
+                    return map_node_ptr();
+                }
+            }
+            else if (child->entries.size() == 1 && child->entries[0].is_leaf())
+            {
+                // Pull a lone leaf up into this node
+                copy->entries[index] = child->entries[0];
+            }
+            else
+            {
+                copy->entries[index].child = child;
+            }
+            return copy;
+        }
+
+        template <class F>
+        static void for_each_member(const map_node* node, F& f)
+        {
+            for (const auto& entry : node->entries)
+            {
+                if (entry.is_leaf())
+                {
+                    f(string_view_type(entry.key.data(), entry.key.size()), entry.value);
+                }
+                else
+                {
+                    for_each_member(entry.child.get(), f);
+                }
+            }
+        }
+    };
+
+    template <class Json>
+    struct persistent_json<Json>::vector_node
+    {
+        using vector_node_ptr_allocator = typename std::allocator_traits<allocator_type>:: template rebind_alloc<vector_node_ptr>;
+        using value_allocator = typename std::allocator_traits<allocator_type>:: template rebind_alloc<persistent_json>;
+
+        std::vector<vector_node_ptr,vector_node_ptr_allocator> children;
+        std::vector<persistent_json,value_allocator> values;
+
+        explicit vector_node(const allocator_type& alloc)
+            : children(vector_node_ptr_allocator(alloc)), values(value_allocator(alloc))
+        {
+        }
+    };
+
+    template <class Json>
+    struct persistent_json<Json>::map_entry
+    {
+        map_node_ptr child;
+        key_type key;
+        persistent_json value;
+
+        map_entry(const map_node_ptr& child, const allocator_type& alloc)
+            : child(child), key(char_allocator_type(alloc)), value()
+        {
+        }
+
+        map_entry(const key_type& key, const persistent_json& value)
+            : child(), key(key), value(value)
+        {
+        }
+
+        bool is_leaf() const noexcept
+        {
+            return !child;
+        }
+    };
+
+    // A node below the last level of the hash holds colliding leaves in
+    // entries, and does not use bitmap
+    template <class Json>
+    struct persistent_json<Json>::map_node
+    {
+        using map_entry_allocator = typename std::allocator_traits<allocator_type>:: template rebind_alloc<map_entry>;
+
+        uint32_t bitmap;
+        std::vector<map_entry,map_entry_allocator> entries;
+
+        explicit map_node(const allocator_type& alloc)
+            : bitmap(0), entries(map_entry_allocator(alloc))
+        {
+        }
+    };
+
+} // namespace jsoncons
+
+#endif
@@ -0,0 +1,681 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_PIPELINED_STAJ_ITERATOR_HPP
+#define JSONCONS_PIPELINED_STAJ_ITERATOR_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception> // std::exception_ptr
+#include <iterator> // std::input_iterator_tag
+#include <memory> // std::unique_ptr
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/staj_cursor.hpp>
+
+namespace jsoncons {
+
+namespace detail {
+
+    // The events of one array element, with their string data in two shared buffers
+    template <class CharT>
+    class staj_event_batch
+    {
+        struct entry
+        {
+            basic_staj_event<CharT> event;
+            std::size_t offset;
+            std::size_t length;
+        };
+
+        std::vector<entry> entries_;
+        std::basic_string<CharT> text_;
+        std::vector<uint8_t> bytes_;
+    public:
+        std::size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+
+        void clear()
+        {
+            entries_.clear();
+            text_.clear();
+            bytes_.clear();
+        }
+
+        void push_back(const basic_staj_event<CharT>& ev)
+        {
+            switch (ev.event_type())
+            {
+                case staj_event_type::key:
+                case staj_event_type::string_value:
+                {
+                    auto sv = ev.template get<jsoncons::basic_string_view<CharT>>();
+                    entries_.push_back(entry{ev, text_.size(), sv.length()});
+                    text_.append(sv.data(), sv.length());
+                    break;
+                }
+                case staj_event_type::byte_string_value:
+                {
+                    auto bytes = ev.template get<byte_string_view>();
+                    entries_.push_back(entry{ev, bytes_.size(), bytes.size()});
+                    bytes_.insert(bytes_.end(), bytes.begin(), bytes.end());
+                    break;
+                }
+                default:
+                    entries_.push_back(entry{ev, 0, 0});
+                    break;
+            }
+        }
+
+        basic_staj_event<CharT> operator[](std::size_t i) const
+        {
+            const entry& e = entries_[i];
+            switch (e.event.event_type())
+            {
+                case staj_event_type::key:
+                case staj_event_type::string_value:
+                    return basic_staj_event<CharT>(jsoncons::basic_string_view<CharT>(text_.data() + e.offset, e.length),
+                                                   e.event.event_type(), e.event.tag());
+                case staj_event_type::byte_string_value:
+                    if (e.event.tag() == semantic_tag::ext)
+                    {
+                        return basic_staj_event<CharT>(byte_string_view(bytes_.data() + e.offset, e.length),
+                                                       e.event.event_type(), e.event.ext_tag());
+                    }
+                    return basic_staj_event<CharT>(byte_string_view(bytes_.data() + e.offset, e.length),
+                                                   e.event.event_type(), e.event.tag());
+                default:
+                    return e.event;
+            }
+        }
+    };
+
+    // A cursor over the events of a batch
+    template <class CharT>
+    class staj_replay_cursor : public basic_staj_cursor<CharT>, private virtual ser_context
+    {
+        const staj_event_batch<CharT>* batch_;
+        std::size_t index_;
+        basic_staj_event<CharT> current_;
+    public:
+        staj_replay_cursor()
+            : batch_(nullptr), index_(0), current_(staj_event_type::null_value)
+        {
+        }
+
+        void reset(const staj_event_batch<CharT>& batch)
+        {
+            batch_ = std::addressof(batch);
+            index_ = 0;
+            if (batch.size() > 0)
+            {
+                current_ = batch[0];
+            }
+        }
+
+        bool done() const override
+        {
+            return batch_ == nullptr || index_ >= batch_->size();
+        }
+
+        const basic_staj_event<CharT>& current() const override
+        {
+            return current_;
+        }
+
+        // Feeds the current value to the visitor, and leaves its last event current
+        void read_to(basic_json_visitor<CharT>& visitor) override
+        {
+            std::error_code ec;
+            read_to(visitor, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+        }
+
+        void read_to(basic_json_visitor<CharT>& visitor, std::error_code& ec) override
+        {
+            std::size_t level = 0;
+            while (!done())
+            {
+                switch (current_.event_type())
+                {
+                    case staj_event_type::begin_array:
+                    case staj_event_type::begin_object:
+                        ++level;
+                        break;
+                    case staj_event_type::end_array:
+                    case staj_event_type::end_object:
+                        --level;
+                        break;
+                    default:
+                        break;
+                }
+                staj_to_saj_event(current_, visitor, *this, ec);
+                if (ec || level == 0 || index_ + 1 >= batch_->size())
+                {
+                    break;
+                }
+                next(ec);
+            }
+            visitor.flush();
+        }
+
+        void next() override
+        {
+            std::error_code ec;
+            next(ec);
+        }
+
+        void next(std::error_code&) override
+        {
+            if (!done() && ++index_ < batch_->size())
+            {
+                current_ = (*batch_)[index_];
+            }
+            // At the last event, done() becomes true and the event stays current
+        }
+
+        const ser_context& context() const override
+        {
+            return *this;
+        }
+
+        std::size_t line() const override
+        {
+            return 0;
+        }
+
+        std::size_t column() const override
+        {
+            return 0;
+        }
+    };
+
+} // namespace detail
+
+    template <class T, class Json>
+    class pipelined_staj_array_view;
+
+    template<class T, class Json>
+    class pipelined_staj_array_iterator
+    {
+        pipelined_staj_array_view<T, Json>* view_;
+        std::exception_ptr eptr_;
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+        using iterator_category = std::input_iterator_tag;
+
+        pipelined_staj_array_iterator() noexcept
+            : view_(nullptr)
+        {
+        }
+
+        pipelined_staj_array_iterator(pipelined_staj_array_view<T, Json>& view)
+            : view_(std::addressof(view))
+        {
+            if (view_->start())
+            {
+                next();
+            }
+            else
+            {
+                view_ = nullptr;
+            }
+        }
+
+        pipelined_staj_array_iterator(pipelined_staj_array_view<T, Json>& view,
+                                      std::error_code& ec)
+            : view_(std::addressof(view))
+        {
+            if (view_->start())
+            {
+                next(ec);
+                if (ec) {view_ = nullptr;}
+            }
+            else
+            {
+                view_ = nullptr;
+            }
+        }
+
+        bool has_value() const
+        {
+            return !eptr_;
+        }
+
+        const T& operator*() const
+        {
+            if (eptr_)
+            {
+                 std::rethrow_exception(eptr_);
+            }
+            return *view_->value_;
+        }
+
+        const T* operator->() const
+        {
+            if (eptr_)
+            {
+                 std::rethrow_exception(eptr_);
+            }
+            return view_->value_.operator->();
+        }
+
+        pipelined_staj_array_iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        pipelined_staj_array_iterator& increment(std::error_code& ec)
+        {
+            next(ec);
+            if (ec) {view_ = nullptr;}
+            return *this;
+        }
+
+        friend bool operator==(const pipelined_staj_array_iterator& a, const pipelined_staj_array_iterator& b)
+        {
+            return (!a.view_ && !b.view_)
+                || (!a.view_ && b.done())
+                || (!b.view_ && a.done());
+        }
+
+        friend bool operator!=(const pipelined_staj_array_iterator& a, const pipelined_staj_array_iterator& b)
+        {
+            return !(a == b);
+        }
+
+    private:
+        bool done() const
+        {
+            return view_->done();
+        }
+
+        void next()
+        {
+            std::error_code ec;
+            next(ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec, view_->cursor_->context().line(), view_->cursor_->context().column()));
+            }
+        }
+
+        void next(std::error_code& ec)
+        {
+            view_->take_next(eptr_, ec);
+        }
+    };
+
+    // pipelined_staj_array_view
+
+    // Like staj_array_view, but the cursor is read on a producer thread, which copies
+    // the events of each element into a batch, and the batches are decoded into T on a
+    // pool of worker threads. Elements are delivered in order, and no more than capacity
+    // elements are read ahead of the one being delivered.
+    template <class T, class Json>
+    class pipelined_staj_array_view
+    {
+        friend class pipelined_staj_array_iterator<T, Json>;
+    public:
+        using char_type = typename Json::char_type;
+        using iterator = pipelined_staj_array_iterator<T, Json>;
+    private:
+        using batch_type = detail::staj_event_batch<char_type>;
+
+        struct slot
+        {
+            bool ready;
+            jsoncons::optional<T> value;
+            std::exception_ptr eptr;
+
+            slot()
+                : ready(false)
+            {
+            }
+        };
+
+        struct work_item
+        {
+            std::size_t seq;
+            std::unique_ptr<batch_type> batch;
+        };
+
+        // State shared with the threads, kept at a fixed address so that the view can move
+        struct pipeline
+        {
+            std::mutex mutex;
+            std::condition_variable work_available;
+            std::condition_variable result_available;
+            std::condition_variable space_available;
+
+            std::deque<work_item> work;
+            std::vector<std::unique_ptr<batch_type>> free_batches;
+            std::vector<slot> slots;
+
+            std::size_t produced;  // elements read from the cursor
+            std::size_t consumed;  // elements delivered
+            bool producer_done;
+            bool stopping;
+            std::error_code ec;    // cursor error after the produced elements
+            std::exception_ptr eptr;
+
+            std::thread producer;
+            std::vector<std::thread> workers;
+
+            explicit pipeline(std::size_t capacity)
+                : slots(capacity), produced(0), consumed(0),
+                  producer_done(false), stopping(false)
+            {
+            }
+        };
+
+        basic_staj_cursor<char_type>* cursor_;
+        std::size_t worker_count_;
+        std::size_t capacity_;
+        std::unique_ptr<pipeline> pipeline_;
+        jsoncons::optional<T> value_;
+        bool done_;
+    public:
+        pipelined_staj_array_view(basic_staj_cursor<char_type>& cursor,
+                                  std::size_t worker_count = 0,
+                                  std::size_t capacity = 0)
+            : cursor_(std::addressof(cursor)),
+              worker_count_(worker_count != 0 ? worker_count : default_worker_count()),
+              capacity_(capacity != 0 ? capacity : 4*worker_count_),
+              done_(false)
+        {
+        }
+
+        pipelined_staj_array_view(const pipelined_staj_array_view&) = delete;
+        pipelined_staj_array_view(pipelined_staj_array_view&&) = default;
+        pipelined_staj_array_view& operator=(const pipelined_staj_array_view&) = delete;
+        pipelined_staj_array_view& operator=(pipelined_staj_array_view&&) = delete;
+
+        // Stops the threads. If the elements have not all been delivered, the
+        // position of the cursor is unspecified.
+        ~pipelined_staj_array_view() noexcept
+        {
+            stop();
+        }
+
+        std::size_t worker_count() const noexcept
+        {
+            return worker_count_;
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        iterator begin()
+        {
+            return iterator(*this);
+        }
+
+        iterator end()
+        {
+            return iterator();
+        }
+
+    private:
+        static std::size_t default_worker_count()
+        {
+            std::size_t n = std::thread::hardware_concurrency();
+            return n > 1 ? n - 1 : 1;
+        }
+
+        bool done() const
+        {
+            return done_;
+        }
+
+        // Starts the threads if the cursor is on a begin_array event
+        bool start()
+        {
+            if (pipeline_ || cursor_->current().event_type() != staj_event_type::begin_array)
+            {
+                return false;
+            }
+            pipeline_.reset(new pipeline(capacity_));
+            pipeline* p = pipeline_.get();
+            basic_staj_cursor<char_type>* cursor = cursor_;
+            std::size_t capacity = capacity_;
+            p->producer = std::thread([p, cursor, capacity]() {produce(*p, *cursor, capacity);});
+            p->workers.reserve(worker_count_);
+            for (std::size_t i = 0; i < worker_count_; ++i)
+            {
+                p->workers.emplace_back([p]() {work(*p);});
+            }
+            return true;
+        }
+
+        void stop() noexcept
+        {
+            if (!pipeline_)
+            {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock(pipeline_->mutex);
+                pipeline_->stopping = true;
+            }
+            pipeline_->work_available.notify_all();
+            pipeline_->space_available.notify_all();
+            if (pipeline_->producer.joinable())
+            {
+                pipeline_->producer.join();
+            }
+            for (auto& worker : pipeline_->workers)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        // Producer thread: copies the events of each element into a batch
+        static void produce(pipeline& p, basic_staj_cursor<char_type>& cursor, std::size_t capacity)
+        {
+            std::error_code ec;
+            JSONCONS_TRY
+            {
+                std::size_t seq = 0;
+                while (true)
+                {
+                    std::unique_ptr<batch_type> batch;
+                    {
+                        std::unique_lock<std::mutex> lock(p.mutex);
+                        p.space_available.wait(lock, [&p, seq, capacity]() {return p.stopping || seq < p.consumed + capacity;});
+                        if (p.stopping)
+                        {
+                            break;
+                        }
+                        if (!p.free_batches.empty())
+                        {
+                            batch = std::move(p.free_batches.back());
+                            p.free_batches.pop_back();
+                        }
+                    }
+                    if (!batch)
+                    {
+                        batch.reset(new batch_type());
+                    }
+                    batch->clear();
+
+                    cursor.next(ec);
+                    if (ec || cursor.done() || cursor.current().event_type() == staj_event_type::end_array)
+                    {
+                        break;
+                    }
+                    std::size_t level = 0;
+                    do
+                    {
+                        const auto& ev = cursor.current();
+                        batch->push_back(ev);
+                        switch (ev.event_type())
+                        {
+                            case staj_event_type::begin_array:
+                            case staj_event_type::begin_object:
+                                ++level;
+                                break;
+                            case staj_event_type::end_array:
+                            case staj_event_type::end_object:
+                                --level;
+                                break;
+                            default:
+                                break;
+                        }
+                        if (level > 0)
+                        {
+                            cursor.next(ec);
+                        }
+                    }
+                    while (!ec && level > 0 && !cursor.done());
+                    if (ec)
+                    {
+                        break;
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(p.mutex);
+                        p.work.push_back(work_item{seq, std::move(batch)});
+                        p.produced = ++seq;
+                    }
+                    p.work_available.notify_one();
+                }
+            }
+            JSONCONS_CATCH(...)
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.eptr = std::current_exception();
+            }
+            {
+                std::lock_guard<std::mutex> lock(p.mutex);
+                p.ec = ec;
+                p.producer_done = true;
+            }
+            p.work_available.notify_all();
+            p.result_available.notify_all();
+        }
+
+        // Worker thread: decodes batches into T
+        static void work(pipeline& p)
+        {
+            json_decoder<Json> decoder;
+            detail::staj_replay_cursor<char_type> cursor;
+            while (true)
+            {
+                work_item item;
+                {
+                    std::unique_lock<std::mutex> lock(p.mutex);
+                    p.work_available.wait(lock, [&p]() {return p.stopping || p.producer_done || !p.work.empty();});
+                    if (p.work.empty())
+                    {
+                        return;
+                    }
+                    item = std::move(p.work.front());
+                    p.work.pop_front();
+                }
+
+                jsoncons::optional<T> value;
+                std::exception_ptr eptr;
+                JSONCONS_TRY
+                {
+                    std::error_code ec;
+                    cursor.reset(*item.batch);
+                    value = decode_traits<T,char_type>::decode(cursor, decoder, ec);
+                    if (ec)
+                    {
+                        JSONCONS_THROW(ser_error(ec));
+                    }
+                }
+                JSONCONS_CATCH(...)
+                {
+                    eptr = std::current_exception();
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(p.mutex);
+                    slot& s = p.slots[item.seq % p.slots.size()];
+                    s.value = std::move(value);
+                    s.eptr = eptr;
+                    s.ready = true;
+                    p.free_batches.push_back(std::move(item.batch));
+                }
+                p.result_available.notify_all();
+            }
+        }
+
+        // Delivers the next element, in order
+        void take_next(std::exception_ptr& eptr, std::error_code& ec)
+        {
+            if (done_)
+            {
+                return;
+            }
+            pipeline& p = *pipeline_;
+            std::unique_lock<std::mutex> lock(p.mutex);
+            slot& s = p.slots[p.consumed % p.slots.size()];
+            p.result_available.wait(lock, [&p, &s]() {return s.ready || (p.producer_done && p.consumed >= p.produced);});
+            if (!s.ready)
+            {
+                std::exception_ptr producer_eptr = p.eptr;
+                ec = p.ec;
+                lock.unlock();
+                finish();
+                if (producer_eptr)
+                {
+                    std::rethrow_exception(producer_eptr);
+                }
+                return;
+            }
+            eptr = s.eptr;
+            value_ = std::move(s.value);
+            s.value = jsoncons::optional<T>();
+            s.ready = false;
+            ++p.consumed;
+            lock.unlock();
+            p.space_available.notify_one();
+        }
+
+        // All elements have been delivered, the threads are joined so that the
+        // cursor can be used again
+        void finish()
+        {
+            done_ = true;
+            stop();
+        }
+    };
+
+    template <class T, class CharT, class Json=typename std::conditional<is_basic_json<T>::value,T,basic_json<CharT>>::type>
+    pipelined_staj_array_view<T, Json> pipelined_staj_array(basic_staj_cursor<CharT>& cursor,
+                                                            std::size_t worker_count = 0,
+                                                            std::size_t capacity = 0)
+    {
+        return pipelined_staj_array_view<T, Json>(cursor, worker_count, capacity);
+    }
+
+} // namespace jsoncons
+
+#endif
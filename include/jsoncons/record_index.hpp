@@ -0,0 +1,943 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_RECORD_INDEX_HPP
+#define JSONCONS_RECORD_INDEX_HPP
+
+#include <algorithm> // std::stable_sort, std::lower_bound, std::upper_bound
+#include <cstdint>
+#include <cstring> // std::memcpy
+#include <istream>
+#include <limits> // std::numeric_limits
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/basic_json.hpp>
+#include <jsoncons/decode_traits.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/record_index_error.hpp>
+#include <jsoncons/staj_cursor.hpp>
+
+namespace jsoncons {
+
+    enum class record_format : uint8_t
+    {
+        json_lines = 1,
+        json_array,
+        cbor_sequence
+    };
+
+    struct record_index_entry
+    {
+        uint64_t offset;
+        uint64_t length;
+    };
+
+namespace detail {
+
+    // Splits a JSON Pointer into unescaped reference tokens
+    inline
+    bool split_record_key_path(const std::string& path, std::vector<std::string>& tokens)
+    {
+        tokens.clear();
+        if (path.empty())
+        {
+            return true;
+        }
+        if (path[0] != '/')
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < path.size(); ++i)
+        {
+            char c = path[i];
+            if (c == '/')
+            {
+                tokens.emplace_back();
+            }
+            else if (c == '~')
+            {
+                if (i + 1 == path.size() || (path[i+1] != '0' && path[i+1] != '1'))
+                {
+                    return false;
+                }
+                tokens.back().push_back(path[i+1] == '0' ? '~' : '/');
+                ++i;
+            }
+            else
+            {
+                tokens.back().push_back(c);
+            }
+        }
+        return true;
+    }
+
+    inline
+    bool to_record_key_index(const std::string& token, std::size_t& index)
+    {
+        if (token.empty() || (token.size() > 1 && token[0] == '0'))
+        {
+            return false;
+        }
+        index = 0;
+        for (char c : token)
+        {
+            if (c < '0' || c > '9' || index > ((std::numeric_limits<std::size_t>::max)() - 9) / 10)
+            {
+                return false;
+            }
+            index = index*10 + static_cast<std::size_t>(c - '0');
+        }
+        return true;
+    }
+
+    // Positions the cursor on the value that the tokens refer to, returns false
+    // if there is no such value
+    inline
+    bool select_record_key(basic_staj_cursor<char>& cursor,
+                           const std::vector<std::string>& tokens,
+                           std::error_code& ec)
+    {
+        for (const auto& token : tokens)
+        {
+            bool found = false;
+            switch (cursor.current().event_type())
+            {
+                case staj_event_type::begin_object:
+                    found = cursor.skip_to_key(token, ec);
+                    break;
+                case staj_event_type::begin_array:
+                {
+                    std::size_t index;
+                    if (to_record_key_index(token, index))
+                    {
+                        found = cursor.skip_to_index(index, ec);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+            if (ec || !found)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Returns the value that the tokens refer to, or null. Leaves the cursor
+    // somewhere within the record.
+    template <class Json>
+    Json read_record_key(basic_staj_cursor<char>& cursor,
+                         const std::vector<std::string>& tokens,
+                         json_decoder<Json>& decoder,
+                         std::error_code& ec)
+    {
+        if (!select_record_key(cursor, tokens, ec))
+        {
+            return Json::null();
+        }
+        return decode_traits<Json,char>::decode(cursor, decoder, ec);
+    }
+
+    // Finds the records of a JSON text sequence or of a top level JSON array
+    // by matching brackets and strings, without parsing the values
+    class json_record_scanner
+    {
+        static constexpr std::size_t buffer_length = 16384;
+
+        bool in_array_;
+        std::size_t record_level_;
+        std::size_t level_;
+        bool in_string_;
+        bool escape_;
+        bool in_scalar_;
+        bool array_begun_;
+        bool array_ended_;
+        bool capture_;
+        uint64_t position_;
+        uint64_t record_start_;
+        std::string record_;
+        std::vector<char> buffer_;
+    public:
+        json_record_scanner(record_format format, bool capture)
+            : in_array_(format == record_format::json_array),
+              record_level_(format == record_format::json_array ? 1 : 0),
+              level_(0), in_string_(false), escape_(false), in_scalar_(false),
+              array_begun_(false), array_ended_(false), capture_(capture),
+              position_(0), record_start_(0), buffer_(buffer_length)
+        {
+        }
+
+        // Calls f(offset, length, text) for each record, text is empty unless capturing
+        template <class F>
+        void scan(std::istream& is, F f, std::error_code& ec)
+        {
+            bool first = true;
+            while (is)
+            {
+                is.read(buffer_.data(), buffer_.size());
+                std::size_t count = static_cast<std::size_t>(is.gcount());
+                if (count == 0)
+                {
+                    break;
+                }
+                std::size_t start = 0;
+                if (first)
+                {
+                    first = false;
+                    if (count >= 3 && static_cast<uint8_t>(buffer_[0]) == 0xef &&
+                        static_cast<uint8_t>(buffer_[1]) == 0xbb && static_cast<uint8_t>(buffer_[2]) == 0xbf)
+                    {
+                        start = 3;
+                        position_ = 3;
+                    }
+                }
+                scan_buffer(start, count, f, ec);
+                if (ec)
+                {
+                    return;
+                }
+            }
+            if (is.bad())
+            {
+                ec = json_errc::source_error;
+                return;
+            }
+            if (in_scalar_)
+            {
+                in_scalar_ = false;
+                end_record(position_, f);
+            }
+            if (in_string_ || level_ > record_level_)
+            {
+                ec = record_index_errc::unexpected_eof;
+            }
+            else if (in_array_ && !array_ended_)
+            {
+                ec = array_begun_ ? record_index_errc::unexpected_eof : record_index_errc::expected_array;
+            }
+        }
+
+    private:
+        template <class F>
+        void scan_buffer(std::size_t start, std::size_t count, F f, std::error_code& ec)
+        {
+            std::size_t slice = start;
+            const char* p = buffer_.data();
+            for (std::size_t i = start; i < count; ++i, ++position_)
+            {
+                char c = p[i];
+                if (in_string_)
+                {
+                    if (escape_)
+                    {
+                        escape_ = false;
+                    }
+                    else if (c == '\\')
+                    {
+                        escape_ = true;
+                    }
+                    else if (c == '\"')
+                    {
+                        in_string_ = false;
+                        if (level_ == record_level_)
+                        {
+                            append(p, slice, i+1);
+                            end_record(position_+1, f);
+                        }
+                    }
+                    continue;
+                }
+                if (in_scalar_)
+                {
+                    if (!is_scalar_end(c))
+                    {
+                        continue;
+                    }
+                    in_scalar_ = false;
+                    append(p, slice, i);
+                    end_record(position_, f);
+                }
+                switch (c)
+                {
+                    case ' ': case '\t': case '\r': case '\n': case ',':
+                        break;
+                    case '[':
+                    case '{':
+                        if (in_array_ && !array_begun_)
+                        {
+                            if (c != '[')
+                            {
+                                ec = record_index_errc::expected_array;
+                                return;
+                            }
+                            array_begun_ = true;
+                            level_ = 1;
+                            break;
+                        }
+                        if (array_ended_)
+                        {
+                            ec = json_errc::extra_character;
+                            return;
+                        }
+                        if (level_ == record_level_)
+                        {
+                            begin_record(i, slice);
+                        }
+                        ++level_;
+                        break;
+                    case ']':
+                    case '}':
+                        if (level_ == record_level_)
+                        {
+                            if (in_array_ && array_begun_ && !array_ended_ && c == ']')
+                            {
+                                array_ended_ = true;
+                                level_ = 0;
+                                break;
+                            }
+                            ec = c == ']' ? json_errc::unexpected_right_bracket : json_errc::unexpected_right_brace;
+                            return;
+                        }
+                        --level_;
+                        if (level_ == record_level_)
+                        {
+                            append(p, slice, i+1);
+                            end_record(position_+1, f);
+                        }
+                        break;
+                    case '\"':
+                        if (!check_record_begin(ec))
+                        {
+                            return;
+                        }
+                        if (level_ == record_level_)
+                        {
+                            begin_record(i, slice);
+                        }
+                        in_string_ = true;
+                        break;
+                    default:
+                        if (!check_record_begin(ec))
+                        {
+                            return;
+                        }
+                        if (level_ == record_level_)
+                        {
+                            begin_record(i, slice);
+                            in_scalar_ = true;
+                        }
+                        break;
+                }
+            }
+            if (in_string_ || in_scalar_ || level_ > record_level_)
+            {
+                append(p, slice, count);
+            }
+        }
+
+        bool check_record_begin(std::error_code& ec)
+        {
+            if (in_array_ && !array_begun_)
+            {
+                ec = record_index_errc::expected_array;
+                return false;
+            }
+            if (array_ended_)
+            {
+                ec = json_errc::extra_character;
+                return false;
+            }
+            return true;
+        }
+
+        static bool is_scalar_end(char c)
+        {
+            switch (c)
+            {
+                case ' ': case '\t': case '\r': case '\n': case ',':
+                case '[': case ']': case '{': case '}': case '\"':
+                    return true;
+                default:
+                    return false;
+            }
+        }
+
+        void begin_record(std::size_t i, std::size_t& slice)
+        {
+            record_start_ = position_;
+            record_.clear();
+            slice = i;
+        }
+
+        void append(const char* p, std::size_t& slice, std::size_t last)
+        {
+            if (capture_ && last > slice)
+            {
+                record_.append(p + slice, last - slice);
+            }
+            slice = last;
+        }
+
+        template <class F>
+        void end_record(uint64_t end, F& f)
+        {
+            f(record_start_, end - record_start_, record_);
+        }
+    };
+
+    template <class T>
+    void write_record_index_value(std::ostream& os, T val)
+    {
+        uint8_t buf[sizeof(T)];
+        jsoncons::detail::native_to_little(val, buf);
+        os.write(reinterpret_cast<const char*>(buf), sizeof(T));
+    }
+
+    template <class T>
+    bool read_record_index_value(std::istream& is, T& val)
+    {
+        uint8_t buf[sizeof(T)];
+        if (!is.read(reinterpret_cast<char*>(buf), sizeof(T)))
+        {
+            return false;
+        }
+        val = jsoncons::detail::little_to_native<T>(buf, sizeof(T));
+        return true;
+    }
+
+    inline
+    void write_record_index_string(std::ostream& os, const char* data, std::size_t length)
+    {
+        write_record_index_value(os, static_cast<uint32_t>(length));
+        os.write(data, length);
+    }
+
+    inline
+    bool read_record_index_string(std::istream& is, std::string& s)
+    {
+        uint32_t length;
+        if (!read_record_index_value(is, length))
+        {
+            return false;
+        }
+        s.resize(length);
+        return length == 0 || is.read(&s[0], length);
+    }
+
+} // namespace detail
+
+    // basic_record_index
+
+    // Offsets and lengths of the records in a large input, with an optional key
+    // for each record, so that a record can be read without scanning the records before it
+    template <class Json>
+    class basic_record_index
+    {
+    public:
+        using basic_json_type = Json;
+        using entry_type = record_index_entry;
+
+        static constexpr std::size_t npos = (std::numeric_limits<std::size_t>::max)();
+    private:
+        static constexpr uint8_t file_version = 1;
+        enum class key_kind : uint8_t {null_value, false_value, true_value, int64_value,
+                                       uint64_value, double_value, string_value, json_text};
+
+        record_format format_;
+        std::string key_path_;
+        bool has_keys_;
+        std::vector<record_index_entry> entries_;
+        std::vector<Json> keys_;
+        std::vector<std::size_t> key_order_;
+    public:
+        basic_record_index()
+            : format_(record_format::json_lines), has_keys_(false)
+        {
+        }
+
+        basic_record_index(record_format format, const std::string& key_path, bool has_keys)
+            : format_(format), key_path_(key_path), has_keys_(has_keys)
+        {
+        }
+
+        basic_record_index(const basic_record_index&) = default;
+        basic_record_index(basic_record_index&&) = default;
+        basic_record_index& operator=(const basic_record_index&) = default;
+        basic_record_index& operator=(basic_record_index&&) = default;
+
+        record_format format() const noexcept
+        {
+            return format_;
+        }
+
+        // The JSON Pointer that the keys were extracted with
+        const std::string& key_path() const noexcept
+        {
+            return key_path_;
+        }
+
+        bool has_keys() const noexcept
+        {
+            return has_keys_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return entries_.size();
+        }
+
+        bool empty() const noexcept
+        {
+            return entries_.empty();
+        }
+
+        const record_index_entry& operator[](std::size_t i) const
+        {
+            return entries_[i];
+        }
+
+        const record_index_entry& at(std::size_t i) const
+        {
+            if (i >= entries_.size())
+            {
+                JSONCONS_THROW(std::out_of_range("Record number out of range"));
+            }
+            return entries_[i];
+        }
+
+        const Json& key(std::size_t i) const
+        {
+            if (!has_keys_)
+            {
+                JSONCONS_THROW(json_runtime_error<std::domain_error>("Record index has no keys"));
+            }
+            return keys_.at(i);
+        }
+
+        // The record number at position pos in key order
+        std::size_t key_order(std::size_t pos) const
+        {
+            return key_order_.at(pos);
+        }
+
+        // The first position in key order with a key not less than key
+        std::size_t lower_bound(const Json& key) const
+        {
+            auto it = std::lower_bound(key_order_.begin(), key_order_.end(), key,
+                                       [this](std::size_t rec, const Json& k) -> bool {return keys_[rec] < k;});
+            return it - key_order_.begin();
+        }
+
+        // The first position in key order with a key greater than key
+        std::size_t upper_bound(const Json& key) const
+        {
+            auto it = std::upper_bound(key_order_.begin(), key_order_.end(), key,
+                                       [this](const Json& k, std::size_t rec) -> bool {return k < keys_[rec];});
+            return it - key_order_.begin();
+        }
+
+        // The number of the first record with the given key, or npos
+        std::size_t find(const Json& key) const
+        {
+            std::size_t pos = lower_bound(key);
+            return pos < key_order_.size() && keys_[key_order_[pos]] == key ? key_order_[pos] : npos;
+        }
+
+        // Splits the records into n contiguous ranges of about the same number of bytes.
+        // Returns n+1 record numbers, range k is [result[k], result[k+1]).
+        std::vector<std::size_t> partition(std::size_t n) const
+        {
+            std::vector<std::size_t> result;
+            if (n == 0)
+            {
+                return result;
+            }
+            result.reserve(n+1);
+            result.push_back(0);
+            uint64_t total = 0;
+            for (const auto& entry : entries_)
+            {
+                total += entry.length;
+            }
+            uint64_t sum = 0;
+            std::size_t i = 0;
+            for (std::size_t k = 1; k < n; ++k)
+            {
+                double target = static_cast<double>(total) * static_cast<double>(k) / static_cast<double>(n);
+                while (i < entries_.size() && static_cast<double>(sum) + static_cast<double>(entries_[i].length)/2 < target)
+                {
+                    sum += entries_[i].length;
+                    ++i;
+                }
+                result.push_back(i);
+            }
+            result.push_back(entries_.size());
+            return result;
+        }
+
+        void reserve(std::size_t n)
+        {
+            entries_.reserve(n);
+            if (has_keys_)
+            {
+                keys_.reserve(n);
+            }
+        }
+
+        void push_back(uint64_t offset, uint64_t length)
+        {
+            entries_.push_back(record_index_entry{offset, length});
+            if (has_keys_)
+            {
+                keys_.push_back(Json::null());
+            }
+        }
+
+        void push_back(uint64_t offset, uint64_t length, Json key)
+        {
+            entries_.push_back(record_index_entry{offset, length});
+            keys_.push_back(std::move(key));
+            has_keys_ = true;
+        }
+
+        // Sorts the records by key, called after the last record has been added
+        void sort_keys()
+        {
+            key_order_.clear();
+            if (!has_keys_)
+            {
+                return;
+            }
+            key_order_.reserve(keys_.size());
+            for (std::size_t i = 0; i < keys_.size(); ++i)
+            {
+                key_order_.push_back(i);
+            }
+            std::stable_sort(key_order_.begin(), key_order_.end(),
+                             [this](std::size_t a, std::size_t b) -> bool {return keys_[a] < keys_[b];});
+        }
+
+        // Writes the index in a compact binary form
+        void write(std::ostream& os) const
+        {
+            os.write("JCRI", 4);
+            detail::write_record_index_value(os, file_version);
+            detail::write_record_index_value(os, static_cast<uint8_t>(format_));
+            detail::write_record_index_value(os, static_cast<uint8_t>(has_keys_ ? 1 : 0));
+            detail::write_record_index_value(os, static_cast<uint8_t>(0));
+            detail::write_record_index_value(os, static_cast<uint64_t>(entries_.size()));
+            detail::write_record_index_string(os, key_path_.data(), key_path_.size());
+            for (const auto& entry : entries_)
+            {
+                detail::write_record_index_value(os, entry.offset);
+                detail::write_record_index_value(os, entry.length);
+            }
+            if (has_keys_)
+            {
+                for (auto rec : key_order_)
+                {
+                    detail::write_record_index_value(os, static_cast<uint64_t>(rec));
+                }
+                for (const auto& key : keys_)
+                {
+                    write_key(os, key);
+                }
+            }
+        }
+
+        static basic_record_index read(std::istream& is)
+        {
+            std::error_code ec;
+            basic_record_index index = read(is, ec);
+            if (ec)
+            {
+                JSONCONS_THROW(ser_error(ec));
+            }
+            return index;
+        }
+
+        static basic_record_index read(std::istream& is, std::error_code& ec)
+        {
+            basic_record_index index;
+            char magic[4];
+            uint8_t version, format, flags, reserved;
+            uint64_t count;
+            if (!is.read(magic, 4) || std::memcmp(magic, "JCRI", 4) != 0 ||
+                !detail::read_record_index_value(is, version))
+            {
+                ec = record_index_errc::invalid_index_file;
+                return index;
+            }
+            if (version != file_version)
+            {
+                ec = record_index_errc::unsupported_index_version;
+                return index;
+            }
+            if (!detail::read_record_index_value(is, format) || format < 1 || format > 3 ||
+                !detail::read_record_index_value(is, flags) ||
+                !detail::read_record_index_value(is, reserved) ||
+                !detail::read_record_index_value(is, count) ||
+                !detail::read_record_index_string(is, index.key_path_))
+            {
+                ec = record_index_errc::invalid_index_file;
+                return index;
+            }
+            index.format_ = static_cast<record_format>(format);
+            index.has_keys_ = (flags & 1) != 0;
+
+            const std::size_t n = static_cast<std::size_t>(count);
+            index.entries_.reserve((std::min)(n, std::size_t(1) << 20));
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                record_index_entry entry;
+                if (!detail::read_record_index_value(is, entry.offset) ||
+                    !detail::read_record_index_value(is, entry.length))
+                {
+                    ec = record_index_errc::invalid_index_file;
+                    return index;
+                }
+                index.entries_.push_back(entry);
+            }
+            if (index.has_keys_)
+            {
+                index.key_order_.reserve(n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    uint64_t rec;
+                    if (!detail::read_record_index_value(is, rec) || rec >= count)
+                    {
+                        ec = record_index_errc::invalid_index_file;
+                        return index;
+                    }
+                    index.key_order_.push_back(static_cast<std::size_t>(rec));
+                }
+                index.keys_.reserve(n);
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    Json key;
+                    if (!read_key(is, key))
+                    {
+                        ec = record_index_errc::invalid_index_file;
+                        return index;
+                    }
+                    index.keys_.push_back(std::move(key));
+                }
+            }
+            return index;
+        }
+
+    private:
+        static void write_key(std::ostream& os, const Json& key)
+        {
+            switch (key.type())
+            {
+                case json_type::null_value:
+                    detail::write_record_index_value(os, static_cast<uint8_t>(key_kind::null_value));
+                    break;
+                case json_type::bool_value:
+                    detail::write_record_index_value(os, static_cast<uint8_t>(key.as_bool() ? key_kind::true_value : key_kind::false_value));
+                    break;
+                case json_type::int64_value:
+                    detail::write_record_index_value(os, static_cast<uint8_t>(key_kind::int64_value));
+                    detail::write_record_index_value(os, key.template as<int64_t>());
+                    break;
+                case json_type::uint64_value:
+                    detail::write_record_index_value(os, static_cast<uint8_t>(key_kind::uint64_value));
+                    detail::write_record_index_value(os, key.template as<uint64_t>());
+                    break;
+                case json_type::half_value:
+                case json_type::double_value:
+                {
+                    double val = key.template as<double>();
+                    uint64_t bits;
+                    std::memcpy(&bits, &val, sizeof(bits));
+                    detail::write_record_index_value(os, static_cast<uint8_t>(key_kind::double_value));
+                    detail::write_record_index_value(os, bits);
+                    break;
+                }
+                case json_type::string_value:
+                    if (key.tag() == semantic_tag::none)
+                    {
+                        auto sv = key.as_string_view();
+                        detail::write_record_index_value(os, static_cast<uint8_t>(key_kind::string_value));
+                        detail::write_record_index_string(os, sv.data(), sv.size());
+                        break;
+                    }
+                    JSONCONS_FALLTHROUGH;
+                default:
+                {
+                    std::string s;
+                    key.dump(s);
+                    detail::write_record_index_value(os, static_cast<uint8_t>(key_kind::json_text));
+                    detail::write_record_index_string(os, s.data(), s.size());
+                    break;
+                }
+            }
+        }
+
+        static bool read_key(std::istream& is, Json& key)
+        {
+            uint8_t kind;
+            if (!detail::read_record_index_value(is, kind))
+            {
+                return false;
+            }
+            switch (static_cast<key_kind>(kind))
+            {
+                case key_kind::null_value:
+                    key = Json::null();
+                    return true;
+                case key_kind::false_value:
+                case key_kind::true_value:
+                    key = Json(static_cast<key_kind>(kind) == key_kind::true_value);
+                    return true;
+                case key_kind::int64_value:
+                {
+                    int64_t val;
+                    if (!detail::read_record_index_value(is, val))
+                    {
+                        return false;
+                    }
+                    key = Json(val);
+                    return true;
+                }
+                case key_kind::uint64_value:
+                {
+                    uint64_t val;
+                    if (!detail::read_record_index_value(is, val))
+                    {
+                        return false;
+                    }
+                    key = Json(val);
+                    return true;
+                }
+                case key_kind::double_value:
+                {
+                    uint64_t bits;
+                    if (!detail::read_record_index_value(is, bits))
+                    {
+                        return false;
+                    }
+                    double val;
+                    std::memcpy(&val, &bits, sizeof(val));
+                    key = Json(val);
+                    return true;
+                }
+                case key_kind::string_value:
+                case key_kind::json_text:
+                {
+                    std::string s;
+                    if (!detail::read_record_index_string(is, s))
+                    {
+                        return false;
+                    }
+                    if (static_cast<key_kind>(kind) == key_kind::string_value)
+                    {
+                        key = Json(s.data(), s.size());
+                        return true;
+                    }
+                    std::error_code ec;
+                    json_decoder<Json> decoder;
+                    json_cursor cursor(s, ec);
+                    if (!ec)
+                    {
+                        key = decode_traits<Json,char>::decode(cursor, decoder, ec);
+                    }
+                    return !ec;
+                }
+                default:
+                    return false;
+            }
+        }
+    };
+
+    template <class Json>
+    constexpr std::size_t basic_record_index<Json>::npos;
+
+    template <class Json>
+    constexpr uint8_t basic_record_index<Json>::file_version;
+
+    using record_index = basic_record_index<json>;
+
+    // build_record_index
+
+    // Scans newline delimited JSON (or any whitespace separated sequence of JSON texts), or
+    // a top level JSON array, and returns the offsets and lengths of its records. If key_path
+    // is not empty, the value it refers to in each record is kept as the record's key.
+    template <class Json=json>
+    basic_record_index<Json> build_record_index(std::istream& is,
+                                                record_format format,
+                                                const std::string& key_path,
+                                                std::error_code& ec)
+    {
+        basic_record_index<Json> index(format, key_path, !key_path.empty());
+        if (format == record_format::cbor_sequence)
+        {
+            ec = record_index_errc::unsupported_format;
+            return index;
+        }
+        std::vector<std::string> tokens;
+        if (!detail::split_record_key_path(key_path, tokens))
+        {
+            ec = record_index_errc::invalid_key_path;
+            return index;
+        }
+
+        json_decoder<Json> decoder;
+        std::error_code key_ec;
+        detail::json_record_scanner scanner(format, index.has_keys());
+        scanner.scan(is,
+            [&](uint64_t offset, uint64_t length, const std::string& text)
+            {
+                if (key_ec)
+                {
+                    return;
+                }
+                if (!index.has_keys())
+                {
+                    index.push_back(offset, length);
+                    return;
+                }
+                json_cursor cursor(text, key_ec);
+                Json key = key_ec ? Json::null() : detail::read_record_key(cursor, tokens, decoder, key_ec);
+                if (!key_ec)
+                {
+                    index.push_back(offset, length, std::move(key));
+                }
+            },
+            ec);
+        if (!ec && key_ec)
+        {
+            ec = key_ec;
+        }
+        index.sort_keys();
+        return index;
+    }
+
+    template <class Json=json>
+    basic_record_index<Json> build_record_index(std::istream& is,
+                                                record_format format,
+                                                const std::string& key_path = std::string())
+    {
+        std::error_code ec;
+        basic_record_index<Json> index = build_record_index<Json>(is, format, key_path, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec));
+        }
+        return index;
+    }
+
+} // namespace jsoncons
+
+#endif
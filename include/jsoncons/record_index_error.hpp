@@ -0,0 +1,78 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_RECORD_INDEX_ERROR_HPP
+#define JSONCONS_RECORD_INDEX_ERROR_HPP
+
+#include <system_error>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+
+    enum class record_index_errc
+    {
+        success = 0,
+        invalid_key_path = 1,
+        unexpected_eof,
+        expected_array,
+        invalid_index_file,
+        unsupported_index_version,
+        unsupported_format
+    };
+
+    class record_index_error_category_impl
+       : public std::error_category
+    {
+    public:
+        const char* name() const noexcept override
+        {
+            return "jsoncons/record_index";
+        }
+        std::string message(int ev) const override
+        {
+            switch (static_cast<record_index_errc>(ev))
+            {
+                case record_index_errc::invalid_key_path:
+                    return "Invalid JSON Pointer for the record key";
+                case record_index_errc::unexpected_eof:
+                    return "Unexpected end of input inside a record";
+                case record_index_errc::expected_array:
+                    return "Expected a top level array";
+                case record_index_errc::invalid_index_file:
+                    return "Invalid record index file";
+                case record_index_errc::unsupported_index_version:
+                    return "Unsupported record index file version";
+                case record_index_errc::unsupported_format:
+                    return "Unsupported record format";
+                default:
+                    return "Unknown record index error";
+            }
+        }
+    };
+
+    inline
+    const std::error_category& record_index_error_category()
+    {
+      static record_index_error_category_impl instance;
+      return instance;
+    }
+
+    inline
+    std::error_code make_error_code(record_index_errc result)
+    {
+        return std::error_code(static_cast<int>(result),record_index_error_category());
+    }
+
+} // jsoncons
+
+namespace std {
+    template<>
+    struct is_error_code_enum<jsoncons::record_index_errc> : public true_type
+    {
+    };
+}
+
+#endif
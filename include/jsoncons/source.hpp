@@ -145,6 +145,33 @@ namespace jsoncons {
             return position_;
         }
 
+        // The number of characters read since the source was constructed
+        std::size_t offset() const
+        {
+            return position_;
+        }
+
+        // Moves to offset characters from where the stream was when the source was constructed.
+        // Returns false if the stream can't be repositioned.
+        bool seek(std::size_t offset)
+        {
+            JSONCONS_TRY
+            {
+                std::streamoff delta = static_cast<std::streamoff>(offset) - static_cast<std::streamoff>(position_);
+                if (sbuf_->pubseekoff(delta, std::ios_base::cur, std::ios_base::in) == std::streampos(std::streamoff(-1)))
+                {
+                    return false;
+                }
+                stream_ptr_->clear(stream_ptr_->rdstate() & ~(std::ios::eofbit | std::ios::failbit));
+                position_ = offset;
+                return true;
+            }
+            JSONCONS_CATCH(const std::exception&)     
+            {
+                return false;
+            }
+        }
+
         character_result<value_type> get_character()
         {
             JSONCONS_TRY
@@ -217,7 +244,7 @@ namespace jsoncons {
                 {
                     stream_ptr_->clear(stream_ptr_->rdstate() | std::ios::eofbit);
                 }
-                position_ += length;
+                position_ += static_cast<std::size_t>(count);
                 return static_cast<std::size_t>(count);
             }
             JSONCONS_CATCH(const std::exception&)     
@@ -299,6 +326,23 @@ namespace jsoncons {
             return (current_ - data_)/sizeof(value_type) + 1;
         }
 
+        // The number of characters read
+        std::size_t offset() const
+        {
+            return current_ - data_;
+        }
+
+        // Moves to offset characters from the beginning. Returns false if offset is past the end.
+        bool seek(std::size_t offset)
+        {
+            if (offset > (std::size_t)(end_ - data_))
+            {
+                return false;
+            }
+            current_ = data_ + offset;
+            return true;
+        }
+
         character_result<value_type> get_character()
         {
             if (current_ < end_)
@@ -484,6 +528,33 @@ namespace jsoncons {
             return position_;
         }
 
+        // The number of bytes read since the source was constructed
+        std::size_t offset() const
+        {
+            return position_;
+        }
+
+        // Moves to offset bytes from where the stream was when the source was constructed.
+        // Returns false if the stream can't be repositioned.
+        bool seek(std::size_t offset)
+        {
+            JSONCONS_TRY
+            {
+                std::streamoff delta = static_cast<std::streamoff>(offset) - static_cast<std::streamoff>(position_);
+                if (sbuf_->pubseekoff(delta, std::ios_base::cur, std::ios_base::in) == std::streampos(std::streamoff(-1)))
+                {
+                    return false;
+                }
+                stream_ptr_->clear(stream_ptr_->rdstate() & ~(std::ios::eofbit | std::ios::failbit));
+                position_ = offset;
+                return true;
+            }
+            JSONCONS_CATCH(const std::exception&)     
+            {
+                return false;
+            }
+        }
+
         character_result<value_type> get_character()
         {
             JSONCONS_TRY
@@ -556,7 +627,7 @@ namespace jsoncons {
                 {
                     stream_ptr_->clear(stream_ptr_->rdstate() | std::ios::eofbit);
                 }
-                position_ += length;
+                position_ += static_cast<std::size_t>(count);
                 return static_cast<std::size_t>(count);
             }
             JSONCONS_CATCH(const std::exception&)     
@@ -613,6 +684,29 @@ namespace jsoncons {
             return current_ - data_ + 1;
         }
 
+        // The number of bytes read
+        std::size_t offset() const
+        {
+            return current_ - data_;
+        }
+
+        // Moves to offset bytes from the beginning. Returns false if offset is past the end.
+        bool seek(std::size_t offset)
+        {
+            if (offset > (std::size_t)(end_ - data_))
+            {
+                return false;
+            }
+            current_ = data_ + offset;
+            return true;
+        }
+
+        // The next unread byte, valid as long as the bytes the source was constructed from
+        const value_type* current_data() const
+        {
+            return current_;
+        }
+
         character_result<value_type> get_character()
         {
             if (current_ < end_)
@@ -661,6 +755,19 @@ namespace jsoncons {
         }
     };
 
+    // is_contiguous_source
+
+    // A source whose bytes lie in a buffer that outlives it, so that parsers can report
+    // strings as views into the buffer rather than as copies
+
+    template <class Source, class Enable=void>
+    struct is_contiguous_source : std::false_type {};
+
+    template <class Source>
+    struct is_contiguous_source<Source,
+        typename std::enable_if<std::is_same<Source,bytes_source>::value
+    >::type> : std::true_type {};
+
     // binary_iterator source
 
     template <class IteratorT>
@@ -0,0 +1,678 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_STAJ_ADAPTORS_HPP
+#define JSONCONS_STAJ_ADAPTORS_HPP
+
+#include <cstdint>
+#include <initializer_list>
+#include <limits> // std::numeric_limits
+#include <memory> // std::addressof
+#include <stdexcept> // std::invalid_argument
+#include <string>
+#include <system_error>
+#include <type_traits> // std::enable_if, std::is_base_of
+#include <utility> // std::move
+#include <vector>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/json_visitor.hpp>
+#include <jsoncons/ser_context.hpp>
+#include <jsoncons/staj_cursor.hpp>
+
+namespace jsoncons {
+namespace staj {
+
+    // What an adaptor decides about an event
+    enum class verdict : uint8_t
+    {
+        accept,
+        reject,
+        skip    // reject the event, and the value it begins, or the key and its value
+    };
+
+    // Base class of the adaptors that can be applied to a cursor with operator|
+    struct adaptor_base
+    {
+    };
+
+    template <class T>
+    struct is_adaptor : std::is_base_of<adaptor_base, T>
+    {
+    };
+
+    template <class Pred>
+    class filter_adaptor : public adaptor_base
+    {
+        Pred pred_;
+    public:
+        explicit filter_adaptor(Pred pred)
+            : pred_(std::move(pred))
+        {
+        }
+
+        template <class CharT>
+        verdict evaluate(const basic_staj_event<CharT>& event, const ser_context& context)
+        {
+            return pred_(event, context) ? verdict::accept : verdict::reject;
+        }
+
+        template <class CharT>
+        void skipped(const basic_staj_event<CharT>&)
+        {
+        }
+
+        bool done() const
+        {
+            return false;
+        }
+    };
+
+    class take_adaptor : public adaptor_base
+    {
+        std::size_t count_;
+        std::size_t taken_;
+        bool exhausted_;
+    public:
+        explicit take_adaptor(std::size_t count)
+            : count_(count), taken_(0), exhausted_(false)
+        {
+        }
+
+        template <class CharT>
+        verdict evaluate(const basic_staj_event<CharT>&, const ser_context&)
+        {
+            if (taken_ == count_)
+            {
+                exhausted_ = true;
+                return verdict::reject;
+            }
+            ++taken_;
+            return verdict::accept;
+        }
+
+        template <class CharT>
+        void skipped(const basic_staj_event<CharT>&)
+        {
+        }
+
+        bool done() const
+        {
+            return exhausted_;
+        }
+    };
+
+    class max_depth_adaptor : public adaptor_base
+    {
+        std::size_t max_depth_;
+        std::size_t depth_;
+    public:
+        explicit max_depth_adaptor(std::size_t max_depth)
+            : max_depth_(max_depth), depth_(0)
+        {
+        }
+
+        template <class CharT>
+        verdict evaluate(const basic_staj_event<CharT>& event, const ser_context&)
+        {
+            std::size_t depth = depth_;
+            switch (event.event_type())
+            {
+                case staj_event_type::begin_array:
+                case staj_event_type::begin_object:
+                    ++depth_;
+                    break;
+                case staj_event_type::end_array:
+                case staj_event_type::end_object:
+                    depth = --depth_;
+                    break;
+                default:
+                    break;
+            }
+            return depth <= max_depth_ ? verdict::accept : verdict::reject;
+        }
+
+        template <class CharT>
+        void skipped(const basic_staj_event<CharT>& event)
+        {
+            if (event.event_type() == staj_event_type::begin_array || event.event_type() == staj_event_type::begin_object)
+            {
+                --depth_;
+            }
+        }
+
+        bool done() const
+        {
+            return false;
+        }
+    };
+
+    template <class CharT>
+    class basic_project_adaptor : public adaptor_base
+    {
+        using string_type = std::basic_string<CharT>;
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+
+        struct token
+        {
+            string_type name;
+            bool wildcard;
+            bool has_index;
+            std::size_t index;
+        };
+
+        struct frame
+        {
+            bool object;
+            bool full;
+            std::size_t index;
+            uint64_t mask;
+            bool member_full;
+            uint64_t member_mask;
+        };
+
+        std::vector<std::vector<token>> paths_;
+        uint64_t all_;
+        bool root_full_;
+        std::vector<frame> stack_;
+    public:
+        explicit basic_project_adaptor(const std::vector<string_type>& pointers)
+            : all_(0), root_full_(false)
+        {
+            if (pointers.size() > 64)
+            {
+                JSONCONS_THROW(json_runtime_error<std::invalid_argument>("A projection takes at most 64 paths"));
+            }
+            for (const auto& pointer : pointers)
+            {
+                std::vector<token> tokens;
+                if (!split(pointer, tokens))
+                {
+                    JSONCONS_THROW(json_runtime_error<std::invalid_argument>("Invalid JSON Pointer in projection"));
+                }
+                if (tokens.empty())
+                {
+                    root_full_ = true;
+                }
+                all_ |= uint64_t(1) << paths_.size();
+                paths_.push_back(std::move(tokens));
+            }
+        }
+
+        verdict evaluate(const basic_staj_event<CharT>& event, const ser_context&)
+        {
+            uint64_t mask;
+            bool full;
+            if (stack_.empty())
+            {
+                mask = all_;
+                full = root_full_;
+            }
+            else
+            {
+                frame& f = stack_.back();
+                switch (event.event_type())
+                {
+                    case staj_event_type::end_array:
+                    case staj_event_type::end_object:
+                        stack_.pop_back();
+                        return verdict::accept;
+                    case staj_event_type::key:
+                        if (f.full)
+                        {
+                            return verdict::accept;
+                        }
+                        f.member_mask = match(f.mask, stack_.size() - 1, event.template get<string_view_type>(), f.member_full);
+                        return f.member_mask != 0 ? verdict::accept : verdict::skip;
+                    default:
+                        break;
+                }
+                if (f.full)
+                {
+                    mask = f.mask;
+                    full = true;
+                }
+                else if (f.object)
+                {
+                    mask = f.member_mask;
+                    full = f.member_full;
+                }
+                else
+                {
+                    mask = match(f.mask, stack_.size() - 1, f.index, full);
+                }
+                if (!f.object)
+                {
+                    ++f.index;
+                }
+            }
+
+            switch (event.event_type())
+            {
+                case staj_event_type::begin_array:
+                case staj_event_type::begin_object:
+                    if (!full && mask == 0)
+                    {
+                        return verdict::skip;
+                    }
+                    stack_.push_back(frame{event.event_type() == staj_event_type::begin_object, full, 0, mask, false, 0});
+                    return verdict::accept;
+                default:
+                    // A scalar on the way to a path is kept, so that its key is never left dangling
+                    return full || mask != 0 ? verdict::accept : verdict::reject;
+            }
+        }
+
+        void skipped(const basic_staj_event<CharT>& event)
+        {
+            if (event.event_type() == staj_event_type::begin_array || event.event_type() == staj_event_type::begin_object)
+            {
+                stack_.pop_back();
+            }
+        }
+
+        bool done() const
+        {
+            return false;
+        }
+    private:
+        uint64_t match(uint64_t mask, std::size_t depth, const string_view_type& name, bool& full) const
+        {
+            uint64_t result = 0;
+            full = false;
+            for (std::size_t i = 0; i < paths_.size(); ++i)
+            {
+                if ((mask & (uint64_t(1) << i)) && paths_[i].size() > depth)
+                {
+                    const token& t = paths_[i][depth];
+                    if (t.wildcard || string_view_type(t.name) == name)
+                    {
+                        result |= uint64_t(1) << i;
+                        full = full || paths_[i].size() == depth + 1;
+                    }
+                }
+            }
+            return result;
+        }
+
+        uint64_t match(uint64_t mask, std::size_t depth, std::size_t index, bool& full) const
+        {
+            uint64_t result = 0;
+            full = false;
+            for (std::size_t i = 0; i < paths_.size(); ++i)
+            {
+                if ((mask & (uint64_t(1) << i)) && paths_[i].size() > depth)
+                {
+                    const token& t = paths_[i][depth];
+                    if (t.wildcard || (t.has_index && t.index == index))
+                    {
+                        result |= uint64_t(1) << i;
+                        full = full || paths_[i].size() == depth + 1;
+                    }
+                }
+            }
+            return result;
+        }
+
+        static bool split(const string_type& pointer, std::vector<token>& tokens)
+        {
+            if (pointer.empty())
+            {
+                return true;
+            }
+            if (pointer[0] != '/')
+            {
+                return false;
+            }
+            for (std::size_t i = 0; i < pointer.size(); ++i)
+            {
+                CharT c = pointer[i];
+                if (c == '/')
+                {
+                    tokens.push_back(token{string_type(), false, false, 0});
+                }
+                else if (c == '~')
+                {
+                    if (i + 1 == pointer.size() || (pointer[i+1] != '0' && pointer[i+1] != '1'))
+                    {
+                        return false;
+                    }
+                    tokens.back().name.push_back(pointer[i+1] == '0' ? '~' : '/');
+                    ++i;
+                }
+                else
+                {
+                    tokens.back().name.push_back(c);
+                }
+            }
+            for (auto& t : tokens)
+            {
+                t.wildcard = t.name.size() == 1 && t.name[0] == '*';
+                t.has_index = to_index(t.name, t.index);
+            }
+            return true;
+        }
+
+        static bool to_index(const string_type& name, std::size_t& index)
+        {
+            if (name.empty() || (name.size() > 1 && name[0] == '0'))
+            {
+                return false;
+            }
+            index = 0;
+            for (CharT c : name)
+            {
+                if (c < '0' || c > '9' || index > ((std::numeric_limits<std::size_t>::max)() - 9) / 10)
+                {
+                    return false;
+                }
+                index = index*10 + static_cast<std::size_t>(c - '0');
+            }
+            return true;
+        }
+    };
+
+    // Applies First, then Second to the events that First accepts
+    template <class First, class Second>
+    class adaptor_chain : public adaptor_base
+    {
+        First first_;
+        Second second_;
+    public:
+        adaptor_chain(First first, Second second)
+            : first_(std::move(first)), second_(std::move(second))
+        {
+        }
+
+        template <class CharT>
+        verdict evaluate(const basic_staj_event<CharT>& event, const ser_context& context)
+        {
+            verdict result = first_.evaluate(event, context);
+            return result == verdict::accept ? evaluate_second(event, context) : result;
+        }
+
+        // For an event that First has already accepted
+        template <class CharT>
+        verdict evaluate_second(const basic_staj_event<CharT>& event, const ser_context& context)
+        {
+            verdict result = second_.evaluate(event, context);
+            if (result == verdict::skip)
+            {
+                first_.skipped(event);
+            }
+            return result;
+        }
+
+        template <class CharT>
+        void skipped(const basic_staj_event<CharT>& event)
+        {
+            first_.skipped(event);
+            second_.skipped(event);
+        }
+
+        bool done() const
+        {
+            return first_.done() || second_.done();
+        }
+    };
+
+    template <class Pred>
+    filter_adaptor<Pred> filter(Pred pred)
+    {
+        return filter_adaptor<Pred>(std::move(pred));
+    }
+
+    template <class CharT>
+    basic_project_adaptor<CharT> project(const std::vector<std::basic_string<CharT>>& pointers)
+    {
+        return basic_project_adaptor<CharT>(pointers);
+    }
+
+    inline
+    basic_project_adaptor<char> project(std::initializer_list<std::string> pointers)
+    {
+        return basic_project_adaptor<char>(pointers);
+    }
+
+    inline
+    basic_project_adaptor<wchar_t> project(std::initializer_list<std::wstring> pointers)
+    {
+        return basic_project_adaptor<wchar_t>(pointers);
+    }
+
+    inline
+    take_adaptor take(std::size_t count)
+    {
+        return take_adaptor(count);
+    }
+
+    inline
+    max_depth_adaptor max_depth(std::size_t depth)
+    {
+        return max_depth_adaptor(depth);
+    }
+
+} // namespace staj
+
+namespace detail {
+
+    template <class CharT>
+    CharT staj_cursor_char_type(const basic_staj_cursor<CharT>*);
+
+} // namespace detail
+
+// A cursor that passes on the events of an underlying cursor that an adaptor accepts.
+// The adaptor is held by value, so composing adaptors with operator| builds the whole
+// pipeline into one type, and the tests on each event are ordinary inlinable calls.
+template <class CharT, class Cursor, class Adaptor>
+class basic_staj_adaptor_view : public basic_staj_cursor<CharT>
+{
+    template <class C, class T, class A> friend class basic_staj_adaptor_view;
+
+    Cursor* cursor_;
+    Adaptor adaptor_;
+public:
+    using char_type = CharT;
+    using cursor_type = Cursor;
+    using adaptor_type = Adaptor;
+
+    basic_staj_adaptor_view(Cursor& cursor, Adaptor adaptor)
+        : cursor_(std::addressof(cursor)), adaptor_(std::move(adaptor))
+    {
+        std::error_code ec;
+        settle(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    template <class First, class Second>
+    basic_staj_adaptor_view(basic_staj_adaptor_view<CharT,Cursor,First>&& view, Second adaptor)
+        : cursor_(view.cursor_), adaptor_(std::move(view.adaptor_), std::move(adaptor))
+    {
+        if (cursor_->done() || adaptor_.done())
+        {
+            return;
+        }
+        // The current event has already passed the adaptors of view
+        std::error_code ec;
+        switch (adaptor_.evaluate_second(cursor_->current(), cursor_->context()))
+        {
+            case staj::verdict::accept:
+                return;
+            case staj::verdict::skip:
+                cursor_->skip(ec);
+                break;
+            default:
+                cursor_->next(ec);
+                break;
+        }
+        if (!ec)
+        {
+            settle(ec);
+        }
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    bool done() const override
+    {
+        return cursor_->done() || adaptor_.done();
+    }
+
+    const basic_staj_event<CharT>& current() const override
+    {
+        return cursor_->current();
+    }
+
+    void read_to(basic_json_visitor<CharT>& visitor) override
+    {
+        std::error_code ec;
+        read_to(visitor, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    // Reports the accepted events of the current value, leaving the last of them current
+    void read_to(basic_json_visitor<CharT>& visitor,
+                 std::error_code& ec) override
+    {
+        std::size_t level = 0;
+        while (!done())
+        {
+            switch (current().event_type())
+            {
+                case staj_event_type::begin_array:
+                case staj_event_type::begin_object:
+                    ++level;
+                    break;
+                case staj_event_type::end_array:
+                case staj_event_type::end_object:
+                    --level;
+                    break;
+                default:
+                    break;
+            }
+            staj_to_saj_event(current(), visitor, context(), ec);
+            if (ec || level == 0)
+            {
+                break;
+            }
+            next(ec);
+            if (ec)
+            {
+                break;
+            }
+        }
+        visitor.flush();
+    }
+
+    void next() override
+    {
+        std::error_code ec;
+        next(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    void next(std::error_code& ec) override
+    {
+        cursor_->next(ec);
+        if (!ec)
+        {
+            settle(ec);
+        }
+    }
+
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        switch (current().event_type())
+        {
+            case staj_event_type::key:
+            case staj_event_type::begin_array:
+            case staj_event_type::begin_object:
+                adaptor_.skipped(current());
+                cursor_->skip(ec);
+                break;
+            default:
+                cursor_->next(ec);
+                break;
+        }
+        if (!ec)
+        {
+            settle(ec);
+        }
+    }
+
+    const ser_context& context() const override
+    {
+        return cursor_->context();
+    }
+
+    const Adaptor& adaptor() const
+    {
+        return adaptor_;
+    }
+private:
+    // Moves the underlying cursor forward until the adaptor accepts its current event
+    void settle(std::error_code& ec)
+    {
+        while (!cursor_->done() && !adaptor_.done())
+        {
+            switch (adaptor_.evaluate(cursor_->current(), cursor_->context()))
+            {
+                case staj::verdict::accept:
+                    return;
+                case staj::verdict::skip:
+                    cursor_->skip(ec);
+                    break;
+                default:
+                    cursor_->next(ec);
+                    break;
+            }
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+};
+
+template <class Cursor, class Adaptor>
+typename std::enable_if<staj::is_adaptor<Adaptor>::value,
+    basic_staj_adaptor_view<decltype(detail::staj_cursor_char_type(std::declval<Cursor*>())),Cursor,Adaptor>>::type
+operator|(Cursor& cursor, Adaptor adaptor)
+{
+    return basic_staj_adaptor_view<decltype(detail::staj_cursor_char_type(std::declval<Cursor*>())),Cursor,Adaptor>(cursor, std::move(adaptor));
+}
+
+template <class CharT, class Cursor, class Adaptor, class Next>
+typename std::enable_if<staj::is_adaptor<Next>::value,
+    basic_staj_adaptor_view<CharT,Cursor,staj::adaptor_chain<Adaptor,Next>>>::type
+operator|(basic_staj_adaptor_view<CharT,Cursor,Adaptor>&& view, Next adaptor)
+{
+    return basic_staj_adaptor_view<CharT,Cursor,staj::adaptor_chain<Adaptor,Next>>(std::move(view), std::move(adaptor));
+}
+
+} // namespace jsoncons
+
+#endif
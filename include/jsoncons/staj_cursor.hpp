@@ -9,6 +9,7 @@
 
 #include <memory> // std::allocator
 #include <string>
+#include <vector>
 #include <stdexcept>
 #include <system_error>
 #include <ios>
@@ -476,10 +477,6 @@ constexpr double_array_arg_t double_array_arg = double_array_arg_t();
 struct float128_array_arg_t {explicit float128_array_arg_t() = default; };
 constexpr float128_array_arg_t float128_array_arg = float128_array_arg_t();
 
-enum class typed_array_type{uint8_value=1,uint16_value,uint32_value,uint64_value,
-                            int8_value,int16_value,int32_value,int64_value, 
-                            half_value, float_value,double_value};
-
 class typed_array_view
 {
     typed_array_type type_;
@@ -701,6 +698,15 @@ public:
         return event_;
     }
 
+    // Makes ev the current event, used by cursors resuming at a bookmark
+    void event(const basic_staj_event<CharT>& ev)
+    {
+        event_ = ev;
+        state_ = staj_cursor_state();
+        data_ = typed_array_view();
+        index_ = 0;
+    }
+
     bool in_available() const
     {
         return state_ != staj_cursor_state();
@@ -1278,6 +1284,109 @@ bool staj_to_saj_event(const basic_staj_event<CharT>& ev,
     }
 }
 
+namespace detail {
+
+    // A copy of an event that owns its string data
+    template <class CharT>
+    class staj_event_copy
+    {
+        basic_staj_event<CharT> event_;
+        std::basic_string<CharT> text_;
+        std::vector<uint8_t> bytes_;
+    public:
+        staj_event_copy()
+            : event_(staj_event_type::null_value)
+        {
+        }
+
+        explicit staj_event_copy(const basic_staj_event<CharT>& ev)
+            : event_(ev)
+        {
+            switch (ev.event_type())
+            {
+                case staj_event_type::key:
+                case staj_event_type::string_value:
+                {
+                    auto sv = ev.template get<jsoncons::basic_string_view<CharT>>();
+                    text_.assign(sv.data(), sv.length());
+                    break;
+                }
+                case staj_event_type::byte_string_value:
+                {
+                    auto bytes = ev.template get<byte_string_view>();
+                    bytes_.assign(bytes.begin(), bytes.end());
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        // The event, with string data referring to this copy
+        basic_staj_event<CharT> event() const
+        {
+            switch (event_.event_type())
+            {
+                case staj_event_type::key:
+                case staj_event_type::string_value:
+                    return basic_staj_event<CharT>(jsoncons::basic_string_view<CharT>(text_.data(), text_.length()), 
+                                                   event_.event_type(), event_.tag());
+                case staj_event_type::byte_string_value:
+                    if (event_.tag() == semantic_tag::ext)
+                    {
+                        return basic_staj_event<CharT>(byte_string_view(bytes_.data(), bytes_.size()), 
+                                                       event_.event_type(), event_.ext_tag());
+                    }
+                    return basic_staj_event<CharT>(byte_string_view(bytes_.data(), bytes_.size()), 
+                                                   event_.event_type(), event_.tag());
+                default:
+                    return event_;
+            }
+        }
+    };
+
+} // namespace detail
+
+// basic_staj_bookmark
+
+// A position in the input that a cursor can return to with seek. Holds the offset 
+// following the event that was current, the parser state for continuing from there,
+// and a copy of the event.
+template <class CharT, class State>
+class basic_staj_bookmark
+{
+    std::size_t offset_;
+    State state_;
+    detail::staj_event_copy<CharT> event_;
+public:
+    using state_type = State;
+
+    basic_staj_bookmark()
+        : offset_(0), state_(), event_()
+    {
+    }
+
+    basic_staj_bookmark(std::size_t offset, State&& state, const basic_staj_event<CharT>& event)
+        : offset_(offset), state_(std::move(state)), event_(event)
+    {
+    }
+
+    std::size_t offset() const noexcept
+    {
+        return offset_;
+    }
+
+    const State& state() const noexcept
+    {
+        return state_;
+    }
+
+    basic_staj_event<CharT> event() const
+    {
+        return event_.event();
+    }
+};
+
 // basic_staj_cursor
 
 template<class CharT>
@@ -1308,6 +1417,147 @@ public:
     virtual void next(std::error_code& ec) = 0;
 
     virtual const ser_context& context() const = 0;
+
+    virtual void skip()
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    // Moves past the current value, or past the current key and its value, 
+    // to the event that follows. Cursors that can step over a container without 
+    // reporting its contents override this.
+    virtual void skip(std::error_code& ec)
+    {
+        switch (current().event_type())
+        {
+            case staj_event_type::key:
+                next(ec);
+                if (ec || done())
+                {
+                    return;
+                }
+                skip(ec);
+                break;
+            case staj_event_type::begin_array:
+            case staj_event_type::begin_object:
+            {
+                std::size_t level = 1;
+                while (level > 0 && !done())
+                {
+                    next(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    switch (current().event_type())
+                    {
+                        case staj_event_type::begin_array:
+                        case staj_event_type::begin_object:
+                            ++level;
+                            break;
+                        case staj_event_type::end_array:
+                        case staj_event_type::end_object:
+                            --level;
+                            break;
+                        default:
+                            break;
+                    }
+                }
+                if (!done())
+                {
+                    next(ec);
+                }
+                break;
+            }
+            default:
+                next(ec);
+                break;
+        }
+    }
+
+    bool skip_to_key(const basic_string_view<CharT>& name)
+    {
+        std::error_code ec;
+        bool found = skip_to_key(name, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+        return found;
+    }
+
+    // Skips members of the object that has just begun, or whose key is current, 
+    // until the member named name. Returns true positioned on its value, or false 
+    // positioned on the end of the object.
+    bool skip_to_key(const basic_string_view<CharT>& name, std::error_code& ec)
+    {
+        if (current().event_type() == staj_event_type::begin_object)
+        {
+            next(ec);
+            if (ec)
+            {
+                return false;
+            }
+        }
+        while (!done() && current().event_type() == staj_event_type::key)
+        {
+            if (current().template get<basic_string_view<CharT>>() == name)
+            {
+                next(ec);
+                return !ec;
+            }
+            skip(ec);
+            if (ec)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool skip_to_index(std::size_t index)
+    {
+        std::error_code ec;
+        bool found = skip_to_index(index, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+        return found;
+    }
+
+    // Skips index elements of the array that has just begun, or of the array 
+    // whose element is current. Returns true positioned on the element that 
+    // follows, or false positioned on the end of the array.
+    bool skip_to_index(std::size_t index, std::error_code& ec)
+    {
+        if (current().event_type() == staj_event_type::begin_array)
+        {
+            next(ec);
+            if (ec)
+            {
+                return false;
+            }
+        }
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            if (done() || current().event_type() == staj_event_type::end_array)
+            {
+                return false;
+            }
+            skip(ec);
+            if (ec)
+            {
+                return false;
+            }
+        }
+        return !done() && current().event_type() != staj_event_type::end_array;
+    }
 };
 
 template<class CharT>
@@ -1365,6 +1615,25 @@ public:
         }
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,context().line(),context().column()));
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        cursor_->skip(ec);
+        while (!done() && !pred_(current(),context()) && !ec)
+        {
+            cursor_->next(ec);
+        }
+    }
+
     const ser_context& context() const override
     {
         return cursor_->context();
@@ -0,0 +1,86 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_STRING_ARENA_HPP
+#define JSONCONS_STRING_ARENA_HPP
+
+#include <cstddef>
+#include <algorithm> // std::max
+#include <vector>
+#include <jsoncons/config/jsoncons_config.hpp>
+
+namespace jsoncons {
+
+    // basic_string_arena
+
+    // Scratch storage for strings that are decoded as views but cannot be borrowed
+    // from the source, for example strings with escapes. A copied string stays at the
+    // same address until clear() is called or the arena is destroyed.
+    template <class CharT>
+    class basic_string_arena
+    {
+    public:
+        using char_type = CharT;
+        using string_view_type = jsoncons::basic_string_view<CharT>;
+    private:
+        static constexpr std::size_t default_block_length = 4096;
+
+        std::vector<std::vector<CharT>> blocks_;
+        std::size_t current_;
+        std::size_t block_length_;
+
+        // Noncopyable
+        basic_string_arena(const basic_string_arena&) = delete;
+        basic_string_arena& operator=(const basic_string_arena&) = delete;
+    public:
+        explicit basic_string_arena(std::size_t block_length = default_block_length)
+            : current_(0), block_length_(block_length == 0 ? 1 : block_length)
+        {
+        }
+
+        basic_string_arena(basic_string_arena&&) = default;
+        basic_string_arena& operator=(basic_string_arena&&) = default;
+
+        // Returns a view of a copy of s that is owned by the arena
+        string_view_type copy(const string_view_type& s)
+        {
+            const std::size_t length = s.size();
+            while (current_ < blocks_.size() && blocks_[current_].capacity() - blocks_[current_].size() < length)
+            {
+                ++current_;
+            }
+            if (current_ == blocks_.size())
+            {
+                blocks_.emplace_back();
+                blocks_.back().reserve((std::max)(block_length_, length));
+            }
+            // The block never grows past its capacity, so earlier copies don't move
+            std::vector<CharT>& block = blocks_[current_];
+            std::size_t offset = block.size();
+            block.insert(block.end(), s.begin(), s.end());
+            return string_view_type(block.data() + offset, length);
+        }
+
+        // Releases the copies, but keeps the storage for reuse
+        void clear()
+        {
+            for (auto& block : blocks_)
+            {
+                block.clear();
+            }
+            current_ = 0;
+        }
+    };
+
+    template <class CharT>
+    constexpr std::size_t basic_string_arena<CharT>::default_block_length;
+
+    using string_arena = basic_string_arena<char>;
+    using wstring_arena = basic_string_arena<wchar_t>;
+
+} // namespace jsoncons
+
+#endif
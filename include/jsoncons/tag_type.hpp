@@ -65,6 +65,20 @@ struct json_const_pointer_arg_t
 };
 
 constexpr json_const_pointer_arg_t json_const_pointer_arg{};
+
+struct borrowed_string_arg_t
+{
+    explicit borrowed_string_arg_t() = default; 
+};
+
+constexpr borrowed_string_arg_t borrowed_string_arg{};
+
+struct typed_array_arg_t
+{
+    explicit typed_array_arg_t() = default; 
+};
+
+constexpr typed_array_arg_t typed_array_arg{};
  
 enum class semantic_tag : uint8_t 
 {
@@ -33,10 +33,12 @@ public:
     using source_type = Src;
     using char_type = char;
     using allocator_type = Allocator;
+    using bookmark_type = basic_staj_bookmark<char,typename basic_bson_parser<Src,Allocator>::resume_state>;
 private:
     basic_bson_parser<Src,Allocator> parser_;
     basic_staj_visitor<char_type> cursor_visitor_;
     bool eof_;
+    jsoncons::detail::staj_event_copy<char_type> seek_event_;
 
     // Noncopyable and nonmoveable
     basic_bson_cursor(const basic_bson_cursor&) = delete;
@@ -153,6 +155,72 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        bool begun = (current().event_type() == staj_event_type::begin_object || 
+                      current().event_type() == staj_event_type::begin_array);
+        if (!(begun && parser_.skip_container(ec)))
+        {
+            basic_staj_cursor<char_type>::skip(ec);
+            return;
+        }
+        if (ec)
+        {
+            return;
+        }
+        read_next(ec); // end_object or end_array
+        if (ec || done())
+        {
+            return;
+        }
+        read_next(ec);
+    }
+
+    // The offset, in bytes from the start of the input, following the current event
+    std::size_t offset() const
+    {
+        return parser_.offset();
+    }
+
+    bookmark_type bookmark() const
+    {
+        return bookmark_type(parser_.offset(), parser_.save_state(), current());
+    }
+
+    void seek(const bookmark_type& bookmark)
+    {
+        std::error_code ec;
+        seek(bookmark, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Makes the bookmarked event current, and continues parsing from the bookmark offset.
+    // Requires a source that can seek.
+    void seek(const bookmark_type& bookmark, std::error_code& ec)
+    {
+        if (!parser_.restore_state(bookmark.state(), bookmark.offset()))
+        {
+            ec = bson_errc::source_error;
+            return;
+        }
+        seek_event_ = jsoncons::detail::staj_event_copy<char_type>(bookmark.event());
+        cursor_visitor_.event(seek_event_.event());
+        eof_ = false;
+    }
+
     const ser_context& context() const override
     {
         return *this;
@@ -56,9 +56,22 @@ class basic_bson_parser : public ser_context
     bool more_;
     bool done_;
     std::basic_string<char,std::char_traits<char>,char_allocator_type> text_buffer_;
+    std::vector<uint8_t,byte_allocator_type> bytes_buffer_;
     std::vector<parse_state,parse_state_allocator_type> state_stack_;
     int nesting_depth_;
 public:
+    // The state needed to continue parsing from a point between items
+    struct resume_state
+    {
+        std::vector<parse_state> state_stack;
+        int nesting_depth;
+
+        resume_state()
+            : nesting_depth(0)
+        {
+        }
+    };
+
     template <class Source>
     basic_bson_parser(Source&& source,
                       const bson_decode_options& options = bson_decode_options(),
@@ -68,6 +81,7 @@ public:
          more_(true), 
          done_(false),
          text_buffer_(alloc),
+         bytes_buffer_(alloc),
          state_stack_(alloc),
          nesting_depth_(0)
 
@@ -98,6 +112,35 @@ public:
         return !more_;
     }
 
+    // The number of bytes read from the source
+    std::size_t offset() const
+    {
+        return source_.offset();
+    }
+
+    resume_state save_state() const
+    {
+        resume_state rs;
+        rs.state_stack.assign(state_stack_.begin(), state_stack_.end());
+        rs.nesting_depth = nesting_depth_;
+        return rs;
+    }
+
+    // Continues from a saved state at offset bytes into the source. Returns false 
+    // if the source can't seek to offset.
+    bool restore_state(const resume_state& rs, std::size_t offset)
+    {
+        if (!source_.seek(offset))
+        {
+            return false;
+        }
+        state_stack_.assign(rs.state_stack.begin(), rs.state_stack.end());
+        nesting_depth_ = rs.nesting_depth;
+        more_ = true;
+        done_ = false;
+        return true;
+    }
+
     std::size_t line() const override
     {
         return 0;
@@ -192,6 +235,29 @@ public:
         }
     }
 
+    // Called after begin_object or begin_array has been reported. Steps over the 
+    // elements of the document using its length, so that the next call to parse 
+    // reports its end. Returns false if no document has just begun.
+    bool skip_container(std::error_code& ec)
+    {
+        const auto& state = state_stack_.back();
+        if ((state.mode != parse_mode::document && state.mode != parse_mode::array) || state.length < 5)
+        {
+            return false;
+        }
+        more_ = true;
+        // The length includes its own four bytes and the trailing null, which is left to end the document
+        std::size_t length = state.length - 5;
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (source_.position() - position != length)
+        {
+            ec = bson_errc::unexpected_eof;
+            more_ = false;
+        }
+        return true;
+    }
+
 private:
 
     void begin_document(json_visitor& visitor, std::error_code& ec)
@@ -237,10 +303,10 @@ private:
             more_ = false;
             return;
         }
-        /* auto len = */ jsoncons::detail::little_to_native<int32_t>(buf, sizeof(buf));
+        auto length = jsoncons::detail::little_to_native<int32_t>(buf, sizeof(buf));
 
         more_ = visitor.begin_array(semantic_tag::none, *this, ec);
-        state_stack_.emplace_back(parse_mode::array,0);
+        state_stack_.emplace_back(parse_mode::array,length);
     }
 
     void end_array(json_visitor& visitor, std::error_code& ec)
@@ -306,9 +372,9 @@ private:
                     return;
                 }
 
-                std::vector<char> s;
+                text_buffer_.clear();
                 std::size_t size = static_cast<std::size_t>(len) - static_cast<std::size_t>(1);
-                if (source_reader<Src>::read(source_,s,size) != size)
+                if (source_reader<Src>::read(source_,text_buffer_,size) != size)
                 {
                     ec = bson_errc::unexpected_eof;
                     more_ = false;
@@ -321,14 +387,14 @@ private:
                     more_ = false;
                     return;
                 }
-                auto result = unicons::validate(s.begin(),s.end());
+                auto result = unicons::validate(text_buffer_.begin(),text_buffer_.end());
                 if (result.ec != unicons::conv_errc())
                 {
                     ec = bson_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                more_ = visitor.string_value(jsoncons::basic_string_view<char>(s.data(),s.size()), semantic_tag::none, *this, ec);
+                more_ = visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
                 break;
             }
             case jsoncons::bson::detail::bson_format::document_cd: 
@@ -438,15 +504,15 @@ private:
                     return;
                 }
 
-                std::vector<uint8_t> v;
-                if (source_reader<Src>::read(source_, v, len) != static_cast<std::size_t>(len))
+                bytes_buffer_.clear();
+                if (source_reader<Src>::read(source_, bytes_buffer_, len) != static_cast<std::size_t>(len))
                 {
                     ec = bson_errc::unexpected_eof;
                     more_ = false;
                     return;
                 }
 
-                more_ = visitor.byte_string_value(byte_string_view(v), 
+                more_ = visitor.byte_string_value(byte_string_view(bytes_buffer_), 
                                                   subtype.value(), 
                                                   *this,
                                                   ec);
@@ -121,6 +121,57 @@ namespace bson {
         return val;
     }
 
+    // decode_bson_into, decodes into an existing value and reuses its storage
+
+    template<class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_byte_sequence<Source>::value>::type 
+    decode_bson_into(const Source& v, T& val,
+                     const bson_decode_options& options = bson_decode_options())
+    {
+        basic_bson_cursor<bytes_source> cursor(v, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_bson_into(std::istream& is, T& val,
+                     const bson_decode_options& options = bson_decode_options())
+    {
+        basic_bson_cursor<binary_stream_source> cursor(is, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T, class InputIt>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_bson_into(InputIt first, InputIt last, T& val,
+                     const bson_decode_options& options = bson_decode_options())
+    {
+        basic_bson_cursor<binary_iterator_source<InputIt>> cursor(binary_iterator_source<InputIt>(first, last), options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
     // With leading allocator parameter
 
     template<class T, class Source, class TempAllocator>
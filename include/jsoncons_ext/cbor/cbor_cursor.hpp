@@ -32,11 +32,25 @@ public:
     using source_type = Src;
     using char_type = char;
     using allocator_type = Allocator;
+
+    // The parser state and the nesting levels of the cursor, for continuing from a bookmark
+    struct resume_state
+    {
+        typename basic_cbor_parser<Src,Allocator>::resume_state parser_state;
+        typename basic_json_visitor2_to_visitor_adaptor<char,Allocator>::level_stack_type levels;
+
+        resume_state()
+            : parser_state(), levels()
+        {
+        }
+    };
+    using bookmark_type = basic_staj_bookmark<char,resume_state>;
 private:
     basic_cbor_parser<Src,Allocator> parser_;
     basic_staj_visitor<char_type> cursor_visitor_;
     basic_json_visitor2_to_visitor_adaptor<char_type,Allocator> cursor_handler_adaptor_;
     bool eof_;
+    jsoncons::detail::staj_event_copy<char_type> seek_event_;
 
     // Noncopyable and nonmoveable
     basic_cbor_cursor(const basic_cbor_cursor&) = delete;
@@ -148,6 +162,103 @@ public:
         read_next(ec);
     }
 
+    void skip() override
+    {
+        std::error_code ec;
+        skip(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void skip(std::error_code& ec) override
+    {
+        bool begun = (current().event_type() == staj_event_type::begin_object || 
+                      current().event_type() == staj_event_type::begin_array) && !cursor_visitor_.in_available();
+        if (!(begun && parser_.skip_container(ec)))
+        {
+            basic_staj_cursor<char_type>::skip(ec);
+            return;
+        }
+        if (ec)
+        {
+            return;
+        }
+        read_next(ec); // end_object or end_array
+        if (ec || done())
+        {
+            return;
+        }
+        read_next(ec);
+    }
+
+    // Continues with the next item of a CBOR sequence. When there are no more items,
+    // leaves the cursor done and eof() true.
+    void reset()
+    {
+        std::error_code ec;
+        reset(ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    void reset(std::error_code& ec)
+    {
+        if (parser_.source_exhausted())
+        {
+            eof_ = true;
+            return;
+        }
+        parser_.reset();
+        next(ec);
+    }
+
+    // The offset, in bytes from the start of the input, following the current event
+    std::size_t offset() const
+    {
+        return parser_.offset();
+    }
+
+    bookmark_type bookmark() const
+    {
+        if (cursor_visitor_.in_available())
+        {
+            JSONCONS_THROW(json_runtime_error<std::domain_error>("Cannot bookmark a typed array element"));
+        }
+        resume_state state;
+        state.parser_state = parser_.save_state();
+        state.levels = cursor_handler_adaptor_.level_stack();
+        return bookmark_type(parser_.offset(), std::move(state), current());
+    }
+
+    void seek(const bookmark_type& bookmark)
+    {
+        std::error_code ec;
+        seek(bookmark, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec,parser_.line(),parser_.column()));
+        }
+    }
+
+    // Makes the bookmarked event current, and continues parsing from the bookmark offset.
+    // Requires a source that can seek.
+    void seek(const bookmark_type& bookmark, std::error_code& ec)
+    {
+        if (!parser_.restore_state(bookmark.state().parser_state, bookmark.offset()))
+        {
+            ec = cbor_errc::source_error;
+            return;
+        }
+        cursor_handler_adaptor_.level_stack(bookmark.state().levels);
+        seek_event_ = jsoncons::detail::staj_event_copy<char_type>(bookmark.event());
+        cursor_visitor_.event(seek_event_.event());
+        eof_ = false;
+    }
+
     const ser_context& context() const override
     {
         return *this;
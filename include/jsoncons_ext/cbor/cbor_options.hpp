@@ -44,9 +44,23 @@ public:
 class cbor_decode_options : public virtual cbor_options_common
 {
     friend class cbor_options;
+
+    bool pack_numeric_arrays_;
+    bool borrow_strings_;
 public:
     cbor_decode_options()
+        : pack_numeric_arrays_(false), borrow_strings_(false)
+    {
+    }
+
+    bool pack_numeric_arrays() const 
     {
+        return pack_numeric_arrays_;
+    }
+
+    bool borrow_strings() const 
+    {
+        return borrow_strings_;
     }
 };
 
@@ -78,6 +92,8 @@ class cbor_options final : public cbor_decode_options, public cbor_encode_option
 {
 public:
     using cbor_options_common::max_nesting_depth;
+    using cbor_decode_options::pack_numeric_arrays;
+    using cbor_decode_options::borrow_strings;
     using cbor_encode_options::pack_strings;
     using cbor_encode_options::use_typed_arrays;
 
@@ -87,6 +103,18 @@ public:
         return *this;
     }
 
+    cbor_options& pack_numeric_arrays(bool value)
+    {
+        this->pack_numeric_arrays_ = value;
+        return *this;
+    }
+
+    cbor_options& borrow_strings(bool value)
+    {
+        this->borrow_strings_ = value;
+        return *this;
+    }
+
     cbor_options& pack_strings(bool value)
     {
         this->use_stringref_ = value;
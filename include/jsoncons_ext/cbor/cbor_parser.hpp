@@ -74,6 +74,8 @@ struct parse_state
 
     parse_state(const parse_state&) = default;
     parse_state(parse_state&&) = default;
+    parse_state& operator=(const parse_state&) = default;
+    parse_state& operator=(parse_state&&) = default;
 };
 
 template <class Src,class Allocator=std::allocator<char>>
@@ -150,6 +152,19 @@ class basic_cbor_parser : public ser_context
     };
 
 public:
+    // The state needed to continue parsing from a point between items
+    struct resume_state
+    {
+        std::vector<parse_state> state_stack;
+        std::vector<stringref_map> stringref_map_stack;
+        int nesting_depth;
+
+        resume_state()
+            : nesting_depth(0)
+        {
+        }
+    };
+
     template <class Source>
     basic_cbor_parser(Source&& source,
                       const cbor_decode_options& options = cbor_decode_options(),
@@ -189,11 +204,49 @@ public:
         return done_;
     }
 
+    // Returns true if no bytes remain in the source
+    bool source_exhausted()
+    {
+        return !source_.peek_character();
+    }
+
     bool stopped() const
     {
         return !more_;
     }
 
+    // The number of bytes read from the source
+    std::size_t offset() const
+    {
+        return source_.offset();
+    }
+
+    resume_state save_state() const
+    {
+        resume_state rs;
+        rs.state_stack.assign(state_stack_.begin(), state_stack_.end());
+        rs.stringref_map_stack.assign(stringref_map_stack_.begin(), stringref_map_stack_.end());
+        rs.nesting_depth = nesting_depth_;
+        return rs;
+    }
+
+    // Continues from a saved state at offset bytes into the source. Returns false 
+    // if the source can't seek to offset.
+    bool restore_state(const resume_state& rs, std::size_t offset)
+    {
+        if (!source_.seek(offset))
+        {
+            return false;
+        }
+        state_stack_.assign(rs.state_stack.begin(), rs.state_stack.end());
+        stringref_map_stack_.assign(rs.stringref_map_stack.begin(), rs.stringref_map_stack.end());
+        nesting_depth_ = rs.nesting_depth;
+        other_tags_.reset();
+        more_ = true;
+        done_ = false;
+        return true;
+    }
+
     std::size_t line() const override
     {
         return 0;
@@ -321,6 +374,46 @@ public:
             }
         }
     }
+
+    // Called after begin_array or begin_object has been reported. Steps over the items 
+    // of the container using their length prefixes, so that the next call to parse 
+    // reports its end. Returns false without consuming anything if the container
+    // can't be stepped over, for example when string references are in scope.
+    bool skip_container(std::error_code& ec)
+    {
+        if (!stringref_map_stack_.empty())
+        {
+            return false;
+        }
+        more_ = true;
+        auto& state = state_stack_.back();
+        switch (state.mode)
+        {
+            case parse_mode::array:
+            case parse_mode::map_key:
+            {
+                std::size_t count = state.mode == parse_mode::map_key ? 2 : 1;
+                for (; state.index < state.length; ++state.index)
+                {
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        skip_item(ec);
+                        if (ec)
+                        {
+                            return true;
+                        }
+                    }
+                }
+                return true;
+            }
+            case parse_mode::indefinite_array:
+            case parse_mode::indefinite_map_key:
+                skip_items_to_break(ec);
+                return true;
+            default:
+                return false;
+        }
+    }
 private:
     void read_item(json_visitor2& visitor, std::error_code& ec)
     {
@@ -437,20 +530,25 @@ private:
             }
             case jsoncons::cbor::detail::cbor_major_type::text_string:
             {
-                text_buffer_.clear();
-                read_text_string(text_buffer_, ec);
+                jsoncons::basic_string_view<char> sv;
+                if (!read_text_view(sv, info, ec, is_contiguous_source<Src>()))
+                {
+                    text_buffer_.clear();
+                    read_text_string(text_buffer_, ec);
+                    sv = jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length());
+                }
                 if (ec)
                 {
                     return;
                 }
-                auto result = unicons::validate(text_buffer_.begin(),text_buffer_.end());
+                auto result = unicons::validate(sv.begin(),sv.end());
                 if (result.ec != unicons::conv_errc())
                 {
                     ec = cbor_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                handle_string(visitor, jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()),ec);
+                handle_string(visitor, sv, ec);
                 if (ec)
                 {
                     return;
@@ -674,6 +772,38 @@ private:
         state_stack_.pop_back();
     }
 
+    // Reports a definite length text string in a contiguous source as a view into the source, 
+    // rather than copying it, unless a later string reference may refer to it. Returns false 
+    // if the string has to be copied.
+    bool read_text_view(jsoncons::basic_string_view<char>& sv, uint8_t info, std::error_code& ec, std::true_type)
+    {
+        if (info == jsoncons::cbor::detail::additional_info::indefinite_length || !stringref_map_stack_.empty())
+        {
+            return false;
+        }
+        std::size_t length = get_size(ec);
+        if (!more_)
+        {
+            return true;
+        }
+        const uint8_t* data = source_.current_data();
+        std::size_t offset = source_.offset();
+        source_.ignore(length);
+        if (source_.offset() - offset != length)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+            return true;
+        }
+        sv = jsoncons::basic_string_view<char>(reinterpret_cast<const char*>(data), length);
+        return true;
+    }
+
+    bool read_text_view(jsoncons::basic_string_view<char>&, uint8_t, std::error_code&, std::false_type)
+    {
+        return false;
+    }
+
     void read_text_string(string_type& s, std::error_code& ec)
     {
         auto c = source_.peek_character();
@@ -721,6 +851,173 @@ private:
         return len;
     }
 
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (source_.position() - position != length)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    // Skips items up to, but not including, a break
+    void skip_items_to_break(std::error_code& ec)
+    {
+        while (true)
+        {
+            auto c = source_.peek_character();
+            if (!c)
+            {
+                ec = cbor_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+            if (c.value() == 0xff)
+            {
+                return;
+            }
+            skip_item(ec);
+            if (ec)
+            {
+                return;
+            }
+        }
+    }
+
+    void skip_item(std::error_code& ec)
+    {
+        auto c = source_.peek_character();
+        if (!c)
+        {
+            ec = cbor_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        while (get_major_type(c.value()) == jsoncons::cbor::detail::cbor_major_type::semantic_tag)
+        {
+            get_uint64_value(ec);
+            if (ec)
+            {
+                return;
+            }
+            c = source_.peek_character();
+            if (!c)
+            {
+                ec = cbor_errc::unexpected_eof;
+                more_ = false;
+                return;
+            }
+        }
+        jsoncons::cbor::detail::cbor_major_type major_type = get_major_type(c.value());
+        uint8_t info = get_additional_information_value(c.value());
+        if (info > 0x1b && info != jsoncons::cbor::detail::additional_info::indefinite_length)
+        {
+            ec = cbor_errc::unknown_type;
+            more_ = false;
+            return;
+        }
+
+        switch (major_type)
+        {
+            case jsoncons::cbor::detail::cbor_major_type::unsigned_integer:
+            case jsoncons::cbor::detail::cbor_major_type::negative_integer:
+                get_uint64_value(ec);
+                break;
+            case jsoncons::cbor::detail::cbor_major_type::byte_string:
+            case jsoncons::cbor::detail::cbor_major_type::text_string:
+                if (info == jsoncons::cbor::detail::additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    skip_items_to_break(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    source_.ignore(1);
+                }
+                else
+                {
+                    std::size_t length = get_size(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    skip_bytes(length, ec);
+                }
+                break;
+            case jsoncons::cbor::detail::cbor_major_type::array:
+            case jsoncons::cbor::detail::cbor_major_type::map:
+            {
+                if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
+                {
+                    ec = cbor_errc::max_nesting_depth_exceeded;
+                    more_ = false;
+                    return;
+                } 
+                if (info == jsoncons::cbor::detail::additional_info::indefinite_length)
+                {
+                    source_.ignore(1);
+                    skip_items_to_break(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    source_.ignore(1);
+                }
+                else
+                {
+                    std::size_t length = get_size(ec);
+                    if (ec)
+                    {
+                        return;
+                    }
+                    std::size_t count = major_type == jsoncons::cbor::detail::cbor_major_type::map ? 2 : 1;
+                    for (std::size_t i = 0; i < length; ++i)
+                    {
+                        for (std::size_t j = 0; j < count; ++j)
+                        {
+                            skip_item(ec);
+                            if (ec)
+                            {
+                                return;
+                            }
+                        }
+                    }
+                }
+                --nesting_depth_;
+                break;
+            }
+            case jsoncons::cbor::detail::cbor_major_type::simple:
+                switch (info)
+                {
+                    case 0x18:
+                        skip_bytes(2, ec);
+                        break;
+                    case 0x19:
+                        skip_bytes(3, ec);
+                        break;
+                    case 0x1a:
+                        skip_bytes(5, ec);
+                        break;
+                    case 0x1b:
+                        skip_bytes(9, ec);
+                        break;
+                    case jsoncons::cbor::detail::additional_info::indefinite_length: // unexpected break
+                        ec = cbor_errc::unknown_type;
+                        more_ = false;
+                        break;
+                    default:
+                        skip_bytes(1, ec);
+                        break;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
     bool read_byte_string(std::vector<uint8_t,byte_allocator_type>& v, std::error_code& ec)
     {
         bool more = true;
@@ -0,0 +1,93 @@
+// Copyright 2021 Daniel Parker
+// Distributed under the Boost license, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// See https://github.com/danielaparker/jsoncons for latest version
+
+#ifndef JSONCONS_CBOR_CBOR_RECORD_INDEX_HPP
+#define JSONCONS_CBOR_CBOR_RECORD_INDEX_HPP
+
+#include <istream>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <jsoncons/json_decoder.hpp>
+#include <jsoncons/json_exception.hpp>
+#include <jsoncons/record_index.hpp>
+#include <jsoncons_ext/cbor/cbor_cursor.hpp>
+
+namespace jsoncons {
+namespace cbor {
+
+    // Scans a CBOR sequence (RFC 8742) and returns the offsets and lengths of its items.
+    // If key_path is not empty, the value it refers to in each item is kept as the item's key.
+    template <class Json=json>
+    basic_record_index<Json> build_cbor_record_index(std::istream& is,
+                                                     const std::string& key_path,
+                                                     std::error_code& ec)
+    {
+        basic_record_index<Json> index(record_format::cbor_sequence, key_path, !key_path.empty());
+        std::vector<std::string> tokens;
+        if (!jsoncons::detail::split_record_key_path(key_path, tokens))
+        {
+            ec = record_index_errc::invalid_key_path;
+            return index;
+        }
+        if (is.peek() == std::istream::traits_type::eof())
+        {
+            is.clear(is.rdstate() & ~std::ios::eofbit);
+            return index;
+        }
+
+        json_decoder<Json> decoder;
+        cbor_stream_cursor cursor(is, ec);
+        uint64_t offset = 0;
+        while (!ec && !cursor.eof())
+        {
+            Json key;
+            if (index.has_keys())
+            {
+                key = jsoncons::detail::read_record_key(cursor, tokens, decoder, ec);
+            }
+            // Step over what remains of the item, containers by their length prefixes
+            while (!ec && !cursor.done())
+            {
+                cursor.skip(ec);
+            }
+            if (ec)
+            {
+                break;
+            }
+            uint64_t end = cursor.offset();
+            if (index.has_keys())
+            {
+                index.push_back(offset, end - offset, std::move(key));
+            }
+            else
+            {
+                index.push_back(offset, end - offset);
+            }
+            offset = end;
+            cursor.reset(ec);
+        }
+        index.sort_keys();
+        return index;
+    }
+
+    template <class Json=json>
+    basic_record_index<Json> build_cbor_record_index(std::istream& is,
+                                                     const std::string& key_path = std::string())
+    {
+        std::error_code ec;
+        basic_record_index<Json> index = build_cbor_record_index<Json>(is, key_path, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec));
+        }
+        return index;
+    }
+
+} // namespace cbor
+} // namespace jsoncons
+
+#endif
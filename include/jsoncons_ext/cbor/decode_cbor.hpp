@@ -29,6 +29,7 @@ namespace cbor {
                 const cbor_decode_options& options = cbor_decode_options())
     {
         jsoncons::json_decoder<T> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         auto adaptor = make_json_visitor_adaptor<json_visitor>(decoder);
         basic_cbor_reader<jsoncons::bytes_source> reader(v, adaptor, options);
         reader.read();
@@ -47,6 +48,34 @@ namespace cbor {
     {
         basic_cbor_cursor<bytes_source> cursor(v, options);
         json_decoder<basic_json<char,sorted_policy>> decoder{};
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::string_view(reinterpret_cast<const char*>(v.data()), v.size()));
+        }
+
+        std::error_code ec;
+        T val = decode_traits<T,char>::decode(cursor, decoder, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+        return val;
+    }
+
+    // String views that cannot reference v are copied into arena
+    template<class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_byte_sequence<Source>::value,T>::type 
+    decode_cbor(const Source& v, 
+                string_arena& arena,
+                const cbor_decode_options& options = cbor_decode_options())
+    {
+        basic_cbor_cursor<bytes_source> cursor(v, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::string_view(reinterpret_cast<const char*>(v.data()), v.size()), &arena);
+        }
 
         std::error_code ec;
         T val = decode_traits<T,char>::decode(cursor, decoder, ec);
@@ -63,6 +92,7 @@ namespace cbor {
                 const cbor_decode_options& options = cbor_decode_options())
     {
         jsoncons::json_decoder<T> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         auto adaptor = make_json_visitor_adaptor<json_visitor>(decoder);
         cbor_stream_reader reader(is, adaptor, options);
         reader.read();
@@ -96,6 +126,7 @@ namespace cbor {
                 const cbor_decode_options& options = cbor_decode_options())
     {
         jsoncons::json_decoder<T> decoder;
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         auto adaptor = make_json_visitor_adaptor<json_visitor>(decoder);
         basic_cbor_reader<binary_iterator_source<InputIt>> reader(binary_iterator_source<InputIt>(first, last), adaptor, options);
         reader.read();
@@ -123,6 +154,61 @@ namespace cbor {
         return val;
     }
 
+    // decode_cbor_into, decodes into an existing value and reuses its storage
+
+    template<class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_byte_sequence<Source>::value>::type 
+    decode_cbor_into(const Source& v, T& val,
+                     const cbor_decode_options& options = cbor_decode_options())
+    {
+        basic_cbor_cursor<bytes_source> cursor(v, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::string_view(reinterpret_cast<const char*>(v.data()), v.size()));
+        }
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_cbor_into(std::istream& is, T& val,
+                     const cbor_decode_options& options = cbor_decode_options())
+    {
+        basic_cbor_cursor<binary_stream_source> cursor(is, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T, class InputIt>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_cbor_into(InputIt first, InputIt last, T& val,
+                     const cbor_decode_options& options = cbor_decode_options())
+    {
+        basic_cbor_cursor<binary_iterator_source<InputIt>> cursor(binary_iterator_source<InputIt>(first, last), options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
     // With leading allocator parameter
 
     template<class T, class Source, class TempAllocator>
@@ -133,6 +219,7 @@ namespace cbor {
                 const cbor_decode_options& options = cbor_decode_options())
     {
         json_decoder<T,TempAllocator> decoder(temp_alloc);
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         auto adaptor = make_json_visitor_adaptor<json_visitor>(decoder);
         basic_cbor_reader<jsoncons::bytes_source,TempAllocator> reader(v, adaptor, options, temp_alloc);
         reader.read();
@@ -169,6 +256,7 @@ namespace cbor {
                 const cbor_decode_options& options = cbor_decode_options())
     {
         json_decoder<T,TempAllocator> decoder(temp_alloc);
+        decoder.pack_numeric_arrays(options.pack_numeric_arrays());
         auto adaptor = make_json_visitor_adaptor<json_visitor>(decoder);
         basic_cbor_reader<jsoncons::binary_stream_source,TempAllocator> reader(is, adaptor, options, temp_alloc);
         reader.read();
@@ -46,6 +46,34 @@ namespace msgpack {
     {
         basic_msgpack_cursor<bytes_source> cursor(v, options);
         json_decoder<basic_json<char,sorted_policy>> decoder{};
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::string_view(reinterpret_cast<const char*>(v.data()), v.size()));
+        }
+
+        std::error_code ec;
+        T val = decode_traits<T,char>::decode(cursor, decoder, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+        return val;
+    }
+
+    // String views that cannot reference v are copied into arena
+    template<class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_byte_sequence<Source>::value,T>::type 
+    decode_msgpack(const Source& v, 
+                   string_arena& arena,
+                   const msgpack_decode_options& options = msgpack_decode_options())
+    {
+        basic_msgpack_cursor<bytes_source> cursor(v, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::string_view(reinterpret_cast<const char*>(v.data()), v.size()), &arena);
+        }
 
         std::error_code ec;
         T val = decode_traits<T,char>::decode(cursor, decoder, ec);
@@ -122,6 +150,61 @@ namespace msgpack {
         return val;
     }
 
+    // decode_msgpack_into, decodes into an existing value and reuses its storage
+
+    template<class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_byte_sequence<Source>::value>::type 
+    decode_msgpack_into(const Source& v, T& val,
+                        const msgpack_decode_options& options = msgpack_decode_options())
+    {
+        basic_msgpack_cursor<bytes_source> cursor(v, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+        if (options.borrow_strings())
+        {
+            decoder.borrow_views_from(jsoncons::string_view(reinterpret_cast<const char*>(v.data()), v.size()));
+        }
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_msgpack_into(std::istream& is, T& val,
+                        const msgpack_decode_options& options = msgpack_decode_options())
+    {
+        basic_msgpack_cursor<binary_stream_source> cursor(is, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T, class InputIt>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_msgpack_into(InputIt first, InputIt last, T& val,
+                        const msgpack_decode_options& options = msgpack_decode_options())
+    {
+        basic_msgpack_cursor<binary_iterator_source<InputIt>> cursor(binary_iterator_source<InputIt>(first, last), options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
     // With leading allocator parameter
 
     template<class T, class Source, class TempAllocator>
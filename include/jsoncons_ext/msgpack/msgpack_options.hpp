@@ -43,9 +43,17 @@ public:
 class msgpack_decode_options : public virtual msgpack_options_common
 {
     friend class msgpack_options;
+
+    bool borrow_strings_;
 public:
     msgpack_decode_options()
+        : borrow_strings_(false)
+    {
+    }
+
+    bool borrow_strings() const 
     {
+        return borrow_strings_;
     }
 };
 
@@ -62,12 +70,19 @@ class msgpack_options final : public msgpack_decode_options, public msgpack_enco
 {
 public:
     using msgpack_options_common::max_nesting_depth;
+    using msgpack_decode_options::borrow_strings;
 
     msgpack_options& max_nesting_depth(int value)
     {
         this->max_nesting_depth_ = value;
         return *this;
     }
+
+    msgpack_options& borrow_strings(bool value)
+    {
+        this->borrow_strings_ = value;
+        return *this;
+    }
 };
 
 }}
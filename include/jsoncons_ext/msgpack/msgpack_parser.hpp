@@ -38,6 +38,8 @@ struct parse_state
 
     parse_state(const parse_state&) = default;
     parse_state(parse_state&&) = default;
+    parse_state& operator=(const parse_state&) = default;
+    parse_state& operator=(parse_state&&) = default;
 };
 
 template <class Src,class Allocator=std::allocator<char>>
@@ -63,6 +65,18 @@ class basic_msgpack_parser : public ser_context
     int nesting_depth_;
 
 public:
+    // The state needed to continue parsing from a point between items
+    struct resume_state
+    {
+        std::vector<parse_state> state_stack;
+        int nesting_depth;
+
+        resume_state()
+            : nesting_depth(0)
+        {
+        }
+    };
+
     template <class Source>
     basic_msgpack_parser(Source&& source,
                          const msgpack_decode_options& options = msgpack_decode_options(),
@@ -102,6 +116,35 @@ public:
         return !more_;
     }
 
+    // The number of bytes read from the source
+    std::size_t offset() const
+    {
+        return source_.offset();
+    }
+
+    resume_state save_state() const
+    {
+        resume_state rs;
+        rs.state_stack.assign(state_stack_.begin(), state_stack_.end());
+        rs.nesting_depth = nesting_depth_;
+        return rs;
+    }
+
+    // Continues from a saved state at offset bytes into the source. Returns false 
+    // if the source can't seek to offset.
+    bool restore_state(const resume_state& rs, std::size_t offset)
+    {
+        if (!source_.seek(offset))
+        {
+            return false;
+        }
+        state_stack_.assign(rs.state_stack.begin(), rs.state_stack.end());
+        nesting_depth_ = rs.nesting_depth;
+        more_ = true;
+        done_ = false;
+        return true;
+    }
+
     std::size_t line() const override
     {
         return 0;
@@ -185,6 +228,32 @@ public:
             }
         }
     }
+
+    // Called after begin_array or begin_object has been reported. Steps over the items 
+    // of the container using their length prefixes, so that the next call to parse 
+    // reports its end. Returns false if no container has just begun.
+    bool skip_container(std::error_code& ec)
+    {
+        auto& state = state_stack_.back();
+        if (state.mode != parse_mode::array && state.mode != parse_mode::map_key)
+        {
+            return false;
+        }
+        more_ = true;
+        std::size_t count = state.mode == parse_mode::map_key ? 2 : 1;
+        for (; state.index < state.length; ++state.index)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                skip_item(ec);
+                if (ec)
+                {
+                    return true;
+                }
+            }
+        }
+        return true;
+    }
 private:
 
     void read_item(json_visitor2& visitor, std::error_code& ec)
@@ -225,23 +294,21 @@ private:
                 // fixstr
                 const size_t len = type & 0x1f;
 
-                text_buffer_.clear();
-
-                if (source_reader<Src>::read(source_,text_buffer_,len) != static_cast<std::size_t>(len))
+                jsoncons::basic_string_view<char> sv;
+                read_text(len, sv, ec);
+                if (ec)
                 {
-                    ec = msgpack_errc::unexpected_eof;
-                    more_ = false;
                     return;
                 }
 
-                auto result = unicons::validate(text_buffer_.begin(),text_buffer_.end());
+                auto result = unicons::validate(sv.begin(),sv.end());
                 if (result.ec != unicons::conv_errc())
                 {
                     ec = msgpack_errc::invalid_utf8_text_string;
                     more_ = false;
                     return;
                 }
-                more_ = visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
+                more_ = visitor.string_value(sv, semantic_tag::none, *this, ec);
             }
         }
         else if (type >= 0xe0) 
@@ -417,22 +484,21 @@ private:
                         return;
                     }
 
-                    text_buffer_.clear();
-                    if (source_reader<Src>::read(source_,text_buffer_,len) != static_cast<std::size_t>(len))
+                    jsoncons::basic_string_view<char> sv;
+                    read_text(len, sv, ec);
+                    if (ec)
                     {
-                        ec = msgpack_errc::unexpected_eof;
-                        more_ = false;
                         return;
                     }
 
-                    auto result = unicons::validate(text_buffer_.begin(),text_buffer_.end());
+                    auto result = unicons::validate(sv.begin(),sv.end());
                     if (result.ec != unicons::conv_errc())
                     {
                         ec = msgpack_errc::invalid_utf8_text_string;
                         more_ = false;
                         return;
                     }
-                    more_ = visitor.string_value(jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length()), semantic_tag::none, *this, ec);
+                    more_ = visitor.string_value(sv, semantic_tag::none, *this, ec);
                     break;
                 }
 
@@ -654,6 +720,160 @@ private:
         state_stack_.pop_back();
     }
 
+    void skip_bytes(std::size_t length, std::error_code& ec)
+    {
+        std::size_t position = source_.position();
+        source_.ignore(length);
+        if (source_.position() - position != length)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            more_ = false;
+        }
+    }
+
+    void skip_item(std::error_code& ec)
+    {
+        auto ch = source_.get_character();
+        if (!ch)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        uint8_t type = ch.value();
+
+        if (type <= 0x7f || type >= jsoncons::msgpack::detail::msgpack_format::negative_fixint_base_cd)
+        {
+            return; // fixint
+        }
+        if (type >= jsoncons::msgpack::detail::msgpack_format::fixstr_base_cd && type <= 0xbf)
+        {
+            skip_bytes(type & 0x1f, ec); // fixstr
+            return;
+        }
+        switch (type)
+        {
+            case jsoncons::msgpack::detail::msgpack_format::nil_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::false_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::true_cd: 
+                break;
+            case jsoncons::msgpack::detail::msgpack_format::uint8_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::int8_cd: 
+                skip_bytes(1, ec);
+                break;
+            case jsoncons::msgpack::detail::msgpack_format::uint16_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::int16_cd: 
+                skip_bytes(2, ec);
+                break;
+            case jsoncons::msgpack::detail::msgpack_format::uint32_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::int32_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::float32_cd: 
+                skip_bytes(4, ec);
+                break;
+            case jsoncons::msgpack::detail::msgpack_format::uint64_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::int64_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::float64_cd: 
+                skip_bytes(8, ec);
+                break;
+            case jsoncons::msgpack::detail::msgpack_format::str8_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::str16_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::str32_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::bin8_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::bin16_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::bin32_cd: 
+            {
+                std::size_t length = get_size(type, ec);
+                if (ec)
+                {
+                    return;
+                }
+                skip_bytes(length, ec);
+                break;
+            }
+            case jsoncons::msgpack::detail::msgpack_format::fixext1_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::fixext2_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::fixext4_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::fixext8_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::fixext16_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::ext8_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::ext16_cd: 
+            case jsoncons::msgpack::detail::msgpack_format::ext32_cd: 
+            {
+                std::size_t length = get_size(type, ec);
+                if (ec)
+                {
+                    return;
+                }
+                skip_bytes(length + 1, ec); // type and data
+                break;
+            }
+            default:
+            {
+                // fixmap, fixarray, map16, map32, array16, array32
+                std::size_t length = get_size(type, ec);
+                if (ec)
+                {
+                    return;
+                }
+                if (JSONCONS_UNLIKELY(++nesting_depth_ > options_.max_nesting_depth()))
+                {
+                    ec = msgpack_errc::max_nesting_depth_exceeded;
+                    more_ = false;
+                    return;
+                } 
+                bool is_map = type <= 0x8f || type == jsoncons::msgpack::detail::msgpack_format::map16_cd || 
+                              type == jsoncons::msgpack::detail::msgpack_format::map32_cd;
+                std::size_t count = is_map ? 2 : 1;
+                for (std::size_t i = 0; i < length; ++i)
+                {
+                    for (std::size_t j = 0; j < count; ++j)
+                    {
+                        skip_item(ec);
+                        if (ec)
+                        {
+                            return;
+                        }
+                    }
+                }
+                --nesting_depth_;
+                break;
+            }
+        }
+    }
+
+    // Reads a text string of length len, as a view into the source if it is contiguous, 
+    // otherwise as a copy
+    void read_text(std::size_t len, jsoncons::basic_string_view<char>& sv, std::error_code& ec)
+    {
+        read_text(len, sv, ec, is_contiguous_source<Src>());
+    }
+
+    void read_text(std::size_t len, jsoncons::basic_string_view<char>& sv, std::error_code& ec, std::true_type)
+    {
+        const uint8_t* data = source_.current_data();
+        std::size_t offset = source_.offset();
+        source_.ignore(len);
+        if (source_.offset() - offset != len)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        sv = jsoncons::basic_string_view<char>(reinterpret_cast<const char*>(data), len);
+    }
+
+    void read_text(std::size_t len, jsoncons::basic_string_view<char>& sv, std::error_code& ec, std::false_type)
+    {
+        text_buffer_.clear();
+        if (source_reader<Src>::read(source_,text_buffer_,len) != len)
+        {
+            ec = msgpack_errc::unexpected_eof;
+            more_ = false;
+            return;
+        }
+        sv = jsoncons::basic_string_view<char>(text_buffer_.data(),text_buffer_.length());
+    }
+
     std::size_t get_size(uint8_t type, std::error_code& ec)
     {
         switch (type)
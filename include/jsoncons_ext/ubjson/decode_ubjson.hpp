@@ -121,6 +121,57 @@ namespace ubjson {
         return val;
     }
 
+    // decode_ubjson_into, decodes into an existing value and reuses its storage
+
+    template<class T, class Source>
+    typename std::enable_if<!is_basic_json<T>::value &&
+                            jsoncons::detail::is_byte_sequence<Source>::value>::type 
+    decode_ubjson_into(const Source& v, T& val,
+                       const ubjson_decode_options& options = ubjson_decode_options())
+    {
+        basic_ubjson_cursor<bytes_source> cursor(v, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_ubjson_into(std::istream& is, T& val,
+                       const ubjson_decode_options& options = ubjson_decode_options())
+    {
+        basic_ubjson_cursor<binary_stream_source> cursor(is, options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
+    template<class T, class InputIt>
+    typename std::enable_if<!is_basic_json<T>::value>::type 
+    decode_ubjson_into(InputIt first, InputIt last, T& val,
+                       const ubjson_decode_options& options = ubjson_decode_options())
+    {
+        basic_ubjson_cursor<binary_iterator_source<InputIt>> cursor(binary_iterator_source<InputIt>(first, last), options);
+        json_decoder<basic_json<char,sorted_policy>> decoder{};
+
+        std::error_code ec;
+        decode_into_traits<T,char>::decode_into(cursor, decoder, val, ec);
+        if (ec)
+        {
+            JSONCONS_THROW(ser_error(ec, cursor.context().line(), cursor.context().column()));
+        }
+    }
+
     // With leading allocator parameter
 
     template<class T, class Source, class TempAllocator>
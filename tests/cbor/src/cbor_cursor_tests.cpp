@@ -261,3 +261,175 @@ TEST_CASE("cbor_cursor with filter tests")
     CHECK(filtered_c.done());
 }
 
+
+TEST_CASE("cbor_cursor skip tests")
+{
+    json j = json::parse(R"(
+{
+    "a" : {"x" : [1, "s", {"y" : -2.5}], "z" : {}, "big" : "123456789012345678901234567890"},
+    "b" : [1, 2, [3, 4], {"c" : 5}],
+    "c" : "found"
+}
+    )");
+    j["a"].insert_or_assign("bytes", json(byte_string({'f','o','o'})));
+    j["a"].insert_or_assign("num", json("-18446744073709551617", semantic_tag::bigint));
+
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(j, data);
+
+    SECTION("skip members")
+    {
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == std::string("a"));
+        cursor.skip();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == std::string("b"));
+        cursor.skip();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == std::string("c"));
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("skip_to_key and skip_to_index")
+    {
+        std::string s(data.begin(), data.end());
+        std::istringstream is(s);
+        cbor::cbor_stream_cursor cursor(is);
+        REQUIRE(cursor.skip_to_key("b"));
+        CHECK(cursor.skip_to_index(3));
+        CHECK(cursor.skip_to_key("c"));
+        CHECK(cursor.current().get<int>() == 5);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+        cursor.next();
+        CHECK(cursor.skip_to_key("c"));
+        CHECK(cursor.current().get<std::string>() == std::string("found"));
+    }
+
+    SECTION("unexpected eof")
+    {
+        data.resize(data.size()/2);
+        cbor::cbor_bytes_cursor cursor(data);
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("cbor_cursor skip indefinite length tests")
+{
+    // {_ "a": [_ 1, "\x5f\x41\x61\xff"], "b": 3}, with an indefinite byte string in the array
+    std::vector<uint8_t> data = {0xbf,0x61,'a',0x9f,0x01,0x5f,0x41,'x',0x41,'y',0xff,0xff,0x61,'b',0x03,0xff};
+
+    cbor::cbor_bytes_cursor cursor(data);
+    CHECK(cursor.skip_to_key("b"));
+    CHECK(cursor.current().get<int>() == 3);
+    cursor.next();
+    CHECK(cursor.current().event_type() == staj_event_type::end_object);
+    cursor.next();
+    CHECK(cursor.done());
+}
+
+namespace {
+
+    template <class Cursor>
+    std::vector<std::string> read_cbor_events(Cursor& cursor)
+    {
+        std::vector<std::string> events;
+        for (; !cursor.done(); cursor.next())
+        {
+            const auto& ev = cursor.current();
+            std::ostringstream os;
+            os << ev.event_type();
+            if (ev.event_type() == staj_event_type::key || ev.event_type() == staj_event_type::string_value)
+            {
+                os << " " << ev.template get<std::string>();
+            }
+            else if (ev.event_type() == staj_event_type::int64_value || ev.event_type() == staj_event_type::uint64_value)
+            {
+                os << " " << ev.template get<int64_t>();
+            }
+            events.push_back(os.str());
+        }
+        return events;
+    }
+
+} // namespace
+
+TEST_CASE("cbor_cursor bookmark and seek tests")
+{
+    json j = json::parse(R"(
+{
+    "a" : {"x" : [1, "s"]},
+    "b" : [1, 2, [3, 4], {"c" : 5}],
+    "c" : "found"
+}
+    )");
+
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(j, data);
+
+    SECTION("bytes source")
+    {
+        cbor::cbor_bytes_cursor cursor(data);
+        REQUIRE(cursor.skip_to_key("b"));
+        cursor.next(); // 1
+        auto bookmark = cursor.bookmark();
+        CHECK(bookmark.offset() == cursor.offset());
+        auto expected = read_cbor_events(cursor);
+        REQUIRE(expected.size() == 14);
+
+        cursor.seek(bookmark);
+        CHECK(cursor.current().get<int>() == 1);
+        CHECK(read_cbor_events(cursor) == expected);
+
+        cursor.seek(bookmark);
+        cursor.next();
+        cursor.next();
+        CHECK(cursor.current().event_type() == staj_event_type::begin_array);
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::begin_object);
+    }
+
+    SECTION("key bookmark")
+    {
+        cbor::cbor_bytes_cursor cursor2(data);
+        cursor2.next();
+        cursor2.skip();
+        cursor2.skip();
+        REQUIRE(cursor2.current().event_type() == staj_event_type::key);
+        auto bookmark = cursor2.bookmark();
+        cursor2.next();
+        cursor2.next();
+        CHECK(cursor2.current().event_type() == staj_event_type::end_object);
+        cursor2.seek(bookmark);
+        CHECK(cursor2.current().event_type() == staj_event_type::key);
+        CHECK(cursor2.current().get<std::string>() == std::string("c"));
+        cursor2.next();
+        CHECK(cursor2.current().get<std::string>() == std::string("found"));
+    }
+
+    SECTION("stream source")
+    {
+        std::string s(data.begin(), data.end());
+        std::istringstream is(s);
+        cbor::cbor_stream_cursor cursor(is);
+        REQUIRE(cursor.skip_to_key("b"));
+        cursor.next(); 
+        cursor.next(); 
+        auto bookmark = cursor.bookmark();
+        auto expected = read_cbor_events(cursor);
+
+        cursor.seek(bookmark);
+        CHECK(cursor.current().get<int>() == 2);
+        CHECK(read_cbor_events(cursor) == expected);
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <jsoncons_ext/cbor/cbor_record_index.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("cbor sequence record_index tests")
+{
+    std::vector<json> records;
+    records.push_back(json::parse(R"({"id" : 20, "data" : {"values" : [1,2,3], "name" : "abc"}})"));
+    records.push_back(json(17));
+    records.push_back(json::parse(R"({"data" : null, "id" : 10})"));
+    records.push_back(json::parse(R"([1,[2,3],"four"])"));
+    records.push_back(json::parse(R"({"id" : 30})"));
+
+    std::vector<uint8_t> data;
+    for (const auto& rec : records)
+    {
+        std::vector<uint8_t> buf;
+        cbor::encode_cbor(rec, buf);
+        data.insert(data.end(), buf.begin(), buf.end());
+    }
+    std::string s(data.begin(), data.end());
+
+    SECTION("offsets and lengths")
+    {
+        std::istringstream is(s);
+        record_index index = cbor::build_cbor_record_index(is);
+        REQUIRE(index.size() == records.size());
+        CHECK(index.format() == record_format::cbor_sequence);
+        CHECK(index[0].offset == 0);
+        for (std::size_t i = 0; i < index.size(); ++i)
+        {
+            std::vector<uint8_t> item(data.begin() + static_cast<std::ptrdiff_t>(index[i].offset),
+                                      data.begin() + static_cast<std::ptrdiff_t>(index[i].offset + index[i].length));
+            CHECK(cbor::decode_cbor<json>(item) == records[i]);
+        }
+    }
+
+    SECTION("keys")
+    {
+        std::istringstream is(s);
+        record_index index = cbor::build_cbor_record_index(is, "/id");
+        REQUIRE(index.size() == records.size());
+        CHECK(index.key(0) == json(20));
+        CHECK(index.key(1).is_null());
+        CHECK(index.key(2) == json(10));
+        CHECK(index.key(3).is_null());
+        CHECK(index.find(json(30)) == 4);
+        CHECK(index.find(json(10)) == 2);
+        CHECK(index[4].offset + index[4].length == data.size());
+    }
+
+    SECTION("nested keys")
+    {
+        std::istringstream is(s);
+        record_index index = cbor::build_cbor_record_index(is, "/1/0");
+        CHECK(index.key(3) == json(2));
+        CHECK(index[4].offset + index[4].length == data.size());
+    }
+
+    SECTION("whole item keys")
+    {
+        std::istringstream is(s);
+        std::error_code ec;
+        record_index index = cbor::build_cbor_record_index(is, "", ec);
+        REQUIRE_FALSE(ec);
+        CHECK_FALSE(index.has_keys());
+    }
+
+    SECTION("empty input")
+    {
+        std::istringstream is("");
+        record_index index = cbor::build_cbor_record_index(is, "/id");
+        CHECK(index.empty());
+    }
+
+    SECTION("truncated item")
+    {
+        std::string truncated = s.substr(0, s.size() - 2);
+        std::istringstream is(truncated);
+        std::error_code ec;
+        cbor::build_cbor_record_index(is, "/id", ec);
+        CHECK(ec == cbor::cbor_errc::unexpected_eof);
+    }
+}
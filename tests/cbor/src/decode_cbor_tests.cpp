@@ -781,3 +781,111 @@ TEST_CASE("encode decode cbor source")
     }
 }
 
+
+namespace decode_cbor_tests {
+
+    struct reading
+    {
+        std::string sensor;
+        std::vector<double> values;
+    };
+
+    struct reading_view
+    {
+        jsoncons::string_view sensor;
+        std::vector<double> values;
+    };
+
+} // namespace decode_cbor_tests
+
+JSONCONS_ALL_MEMBER_TRAITS(decode_cbor_tests::reading, sensor, values)
+JSONCONS_ALL_MEMBER_TRAITS(decode_cbor_tests::reading_view, sensor, values)
+
+TEST_CASE("decode_cbor_into")
+{
+    using decode_cbor_tests::reading;
+
+    reading r1{"temperature sensor 1", {1.5, 2.5, 3.5, 4.5}};
+    reading r2{"t2", {9.0}};
+    std::vector<uint8_t> buffer1;
+    cbor::encode_cbor(r1, buffer1);
+    std::vector<uint8_t> buffer2;
+    cbor::encode_cbor(r2, buffer2);
+
+    SECTION("from bytes")
+    {
+        reading val;
+        cbor::decode_cbor_into(buffer1, val);
+        CHECK(val.sensor == r1.sensor);
+        CHECK(val.values == r1.values);
+
+        const double* values_data = val.values.data();
+        cbor::decode_cbor_into(buffer2, val);
+        CHECK(val.sensor == r2.sensor);
+        CHECK(val.values == r2.values);
+        CHECK(val.values.data() == values_data);
+    }
+
+    SECTION("from stream and iterators")
+    {
+        reading val;
+        std::string s(buffer1.begin(), buffer1.end());
+        std::istringstream is(s);
+        cbor::decode_cbor_into(is, val);
+        CHECK(val.values == r1.values);
+
+        cbor::decode_cbor_into(buffer2.begin(), buffer2.end(), val);
+        CHECK(val.sensor == r2.sensor);
+        CHECK(val.values == r2.values);
+    }
+}
+
+TEST_CASE("decode_cbor string view members")
+{
+    using decode_cbor_tests::reading;
+    using decode_cbor_tests::reading_view;
+
+    auto within = [](const jsoncons::string_view& sv, const std::vector<uint8_t>& v) -> bool
+    {
+        const char* first = reinterpret_cast<const char*>(v.data());
+        return sv.data() >= first && sv.data() + sv.size() <= first + v.size();
+    };
+
+    reading r{"thermometer-12", {20.5, 21.0}};
+
+    SECTION("borrowed from the source")
+    {
+        std::vector<uint8_t> buffer;
+        cbor::encode_cbor(r, buffer);
+
+        auto val = cbor::decode_cbor<reading_view>(buffer, cbor::cbor_options{}.borrow_strings(true));
+        CHECK(val.sensor == r.sensor);
+        CHECK(within(val.sensor, buffer));
+        CHECK(val.values == r.values);
+    }
+
+    SECTION("not borrowable")
+    {
+        std::vector<uint8_t> buffer;
+        cbor::encode_cbor(r, buffer);
+
+        CHECK_THROWS_AS(cbor::decode_cbor<reading_view>(buffer), ser_error);
+
+        std::string s(buffer.begin(), buffer.end());
+        std::istringstream is(s);
+        CHECK_THROWS_AS(cbor::decode_cbor<reading_view>(is, cbor::cbor_options{}.borrow_strings(true)), ser_error);
+    }
+
+    SECTION("string references are copied into the arena")
+    {
+        std::vector<uint8_t> buffer;
+        cbor::encode_cbor(r, buffer, cbor::cbor_options{}.pack_strings(true));
+
+        CHECK_THROWS_AS(cbor::decode_cbor<reading_view>(buffer, cbor::cbor_options{}.borrow_strings(true)), ser_error);
+
+        string_arena arena;
+        auto val = cbor::decode_cbor<reading_view>(buffer, arena, cbor::cbor_options{}.borrow_strings(true));
+        CHECK(val.sensor == r.sensor);
+        CHECK_FALSE(within(val.sensor, buffer));
+    }
+}
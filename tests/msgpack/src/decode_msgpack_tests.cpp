@@ -258,3 +258,98 @@ TEST_CASE("decode msgpack str size tests")
 }
 
 
+
+namespace decode_msgpack_tests {
+
+    struct reading
+    {
+        std::string sensor;
+        std::vector<double> values;
+    };
+
+    struct reading_view
+    {
+        jsoncons::string_view sensor;
+        std::vector<double> values;
+    };
+
+} // namespace decode_msgpack_tests
+
+JSONCONS_ALL_MEMBER_TRAITS(decode_msgpack_tests::reading, sensor, values)
+JSONCONS_ALL_MEMBER_TRAITS(decode_msgpack_tests::reading_view, sensor, values)
+
+TEST_CASE("decode_msgpack_into")
+{
+    using decode_msgpack_tests::reading;
+
+    reading r1{"temperature sensor 1", {1.5, 2.5, 3.5, 4.5}};
+    reading r2{"t2", {9.0}};
+    std::vector<uint8_t> buffer1;
+    msgpack::encode_msgpack(r1, buffer1);
+    std::vector<uint8_t> buffer2;
+    msgpack::encode_msgpack(r2, buffer2);
+
+    SECTION("from bytes")
+    {
+        reading val;
+        msgpack::decode_msgpack_into(buffer1, val);
+        CHECK(val.sensor == r1.sensor);
+        CHECK(val.values == r1.values);
+
+        const double* values_data = val.values.data();
+        msgpack::decode_msgpack_into(buffer2, val);
+        CHECK(val.sensor == r2.sensor);
+        CHECK(val.values == r2.values);
+        CHECK(val.values.data() == values_data);
+    }
+
+    SECTION("from stream and iterators")
+    {
+        reading val;
+        std::string s(buffer1.begin(), buffer1.end());
+        std::istringstream is(s);
+        msgpack::decode_msgpack_into(is, val);
+        CHECK(val.values == r1.values);
+
+        msgpack::decode_msgpack_into(buffer2.begin(), buffer2.end(), val);
+        CHECK(val.sensor == r2.sensor);
+        CHECK(val.values == r2.values);
+    }
+}
+
+TEST_CASE("decode_msgpack string view members")
+{
+    using decode_msgpack_tests::reading;
+    using decode_msgpack_tests::reading_view;
+
+    auto within = [](const jsoncons::string_view& sv, const std::vector<uint8_t>& v) -> bool
+    {
+        const char* first = reinterpret_cast<const char*>(v.data());
+        return sv.data() >= first && sv.data() + sv.size() <= first + v.size();
+    };
+
+    reading r{"thermometer-12", {20.5, 21.0}};
+
+    SECTION("borrowed from the source")
+    {
+        std::vector<uint8_t> buffer;
+        msgpack::encode_msgpack(r, buffer);
+
+        auto val = msgpack::decode_msgpack<reading_view>(buffer, msgpack::msgpack_options{}.borrow_strings(true));
+        CHECK(val.sensor == r.sensor);
+        CHECK(within(val.sensor, buffer));
+        CHECK(val.values == r.values);
+    }
+
+    SECTION("not borrowable")
+    {
+        std::vector<uint8_t> buffer;
+        msgpack::encode_msgpack(r, buffer);
+
+        CHECK_THROWS_AS(msgpack::decode_msgpack<reading_view>(buffer), jsoncons::ser_error);
+
+        std::string s(buffer.begin(), buffer.end());
+        std::istringstream is(s);
+        CHECK_THROWS_AS(msgpack::decode_msgpack<reading_view>(is, msgpack::msgpack_options{}.borrow_strings(true)), jsoncons::ser_error);
+    }
+}
@@ -0,0 +1,298 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/async_json_cursor.hpp>
+#include <catch/catch.hpp>
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Hands out the input a few characters at a time, either at once or from a simulated event loop
+    class chunked_source : public async_source
+    {
+        std::string input_;
+        std::size_t position_;
+        std::size_t chunk_size_;
+        std::deque<std::function<void()>>* loop_;
+        std::error_code fail_at_end_;
+    public:
+        chunked_source(const std::string& input, std::size_t chunk_size,
+                       std::deque<std::function<void()>>* loop = nullptr)
+            : input_(input), position_(0), chunk_size_(chunk_size), loop_(loop)
+        {
+        }
+
+        void fail_at_end(std::error_code ec)
+        {
+            fail_at_end_ = ec;
+        }
+
+        void async_read(char* data, std::size_t length, read_handler handler) override
+        {
+            std::size_t count = (std::min)((std::min)(length, chunk_size_), input_.size() - position_);
+            std::copy(input_.data() + position_, input_.data() + position_ + count, data);
+            position_ += count;
+            std::error_code ec = count == 0 ? fail_at_end_ : std::error_code();
+            if (loop_ == nullptr)
+            {
+                handler(count, ec);
+            }
+            else
+            {
+                loop_->push_back([handler, count, ec]() {handler(count, ec);});
+            }
+        }
+    };
+
+    void run(std::deque<std::function<void()>>& loop)
+    {
+        while (!loop.empty())
+        {
+            auto task = std::move(loop.front());
+            loop.pop_front();
+            task();
+        }
+    }
+
+    // Rebuilds the document from the cursor's events
+    struct event_reader
+    {
+        async_json_cursor& cursor;
+        json_decoder<json> decoder;
+        std::error_code ec;
+        bool finished;
+
+        event_reader(async_json_cursor& c)
+            : cursor(c), finished(false)
+        {
+        }
+
+        void start()
+        {
+            cursor.async_next([this](const std::error_code& e) {on_event(e);});
+        }
+
+        void on_event(const std::error_code& e)
+        {
+            if (e || cursor.done())
+            {
+                ec = e;
+                finished = true;
+                return;
+            }
+            staj_to_saj_event(cursor.current(), decoder, cursor.context(), ec);
+            start();
+        }
+    };
+
+} // namespace
+
+TEST_CASE("async_json_cursor with a source that completes at once")
+{
+    std::string input = R"({"a": [1, 2.5, -3, "four", null, true], "b": {"c": 12345678901234}})";
+
+    for (std::size_t chunk_size : {1, 2, 3, 7, 100})
+    {
+        chunked_source source(input, chunk_size);
+        async_json_cursor cursor(source);
+        cursor.buffer_length(16);
+        event_reader reader(cursor);
+        reader.start();
+        REQUIRE(reader.finished);
+        CHECK_FALSE(reader.ec);
+        CHECK(reader.decoder.get_result() == json::parse(input));
+    }
+}
+
+TEST_CASE("async_json_cursor long runs of immediate completions")
+{
+    std::string input = "[";
+    for (std::size_t i = 0; i < 200000; ++i)
+    {
+        input.append(i == 0 ? "" : ",").append(std::to_string(i));
+    }
+    input.push_back(']');
+
+    chunked_source source(input, 4096);
+    async_json_cursor cursor(source);
+    std::size_t count = 0;
+    bool finished = false;
+    std::function<void(const std::error_code&)> handler = [&](const std::error_code& ec)
+    {
+        if (ec || cursor.done())
+        {
+            finished = true;
+            return;
+        }
+        ++count;
+        cursor.async_next(handler);
+    };
+    cursor.async_next(handler);
+    CHECK(finished);
+    CHECK(count == 200002);
+}
+
+TEST_CASE("async_json_cursor many documents on one event loop")
+{
+    std::deque<std::function<void()>> loop;
+    std::vector<std::string> inputs;
+    for (std::size_t i = 0; i < 50; ++i)
+    {
+        inputs.push_back(R"({"id": )" + std::to_string(i) + R"(, "tags": ["x", "y"], "value": 1.5})");
+    }
+
+    std::vector<std::unique_ptr<chunked_source>> sources;
+    std::vector<std::unique_ptr<async_json_cursor>> cursors;
+    std::vector<std::unique_ptr<json_decoder<json>>> decoders;
+    std::vector<std::error_code> results(inputs.size());
+    std::vector<bool> finished(inputs.size(), false);
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        sources.emplace_back(new chunked_source(inputs[i], 5, &loop));
+        cursors.emplace_back(new async_json_cursor(*sources.back()));
+        decoders.emplace_back(new json_decoder<json>());
+        async_json_cursor* cursor = cursors.back().get();
+        json_decoder<json>* decoder = decoders.back().get();
+        cursor->async_next([&, i, cursor, decoder](const std::error_code& ec)
+        {
+            if (ec)
+            {
+                results[i] = ec;
+                finished[i] = true;
+                return;
+            }
+            cursor->async_read_to(*decoder, [&, i](const std::error_code& ec2)
+            {
+                results[i] = ec2;
+                finished[i] = true;
+            });
+        });
+    }
+    CHECK(std::none_of(finished.begin(), finished.end(), [](bool b) {return b;}));
+    run(loop);
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        CHECK(finished[i]);
+        CHECK_FALSE(results[i]);
+        CHECK(decoders[i]->get_result() == json::parse(inputs[i]));
+    }
+}
+
+TEST_CASE("async_json_cursor errors")
+{
+    SECTION("parse error")
+    {
+        std::deque<std::function<void()>> loop;
+        chunked_source source("[1,]", 2, &loop);
+        async_json_cursor cursor(source);
+        event_reader reader(cursor);
+        reader.start();
+        run(loop);
+        CHECK(reader.finished);
+        CHECK(reader.ec == json_errc::extra_comma);
+    }
+
+    SECTION("unexpected end of input")
+    {
+        chunked_source source("[1, 2", 2);
+        async_json_cursor cursor(source);
+        event_reader reader(cursor);
+        reader.start();
+        CHECK(reader.finished);
+        CHECK(reader.ec == json_errc::unexpected_eof);
+    }
+
+    SECTION("source error")
+    {
+        chunked_source source("[1, 2", 2);
+        source.fail_at_end(std::make_error_code(std::errc::connection_reset));
+        async_json_cursor cursor(source);
+        event_reader reader(cursor);
+        reader.start();
+        CHECK(reader.finished);
+        CHECK(reader.ec == std::errc::connection_reset);
+    }
+}
+
+#if defined(JSONCONS_HAS_COROUTINES)
+
+namespace {
+
+    // A coroutine that starts at once and is never awaited
+    struct fire_and_forget
+    {
+        struct promise_type
+        {
+            fire_and_forget get_return_object() {return fire_and_forget();}
+            std::suspend_never initial_suspend() noexcept {return {};}
+            std::suspend_never final_suspend() noexcept {return {};}
+            void return_void() {}
+            void unhandled_exception() {std::terminate();}
+        };
+    };
+
+    fire_and_forget read_names(async_json_cursor& cursor, std::vector<std::string>& names, std::error_code& ec, bool& finished)
+    {
+        co_await cursor.next(ec);
+        while (!ec && !cursor.done())
+        {
+            if (cursor.current().event_type() == staj_event_type::string_value)
+            {
+                names.push_back(cursor.current().get<std::string>());
+            }
+            co_await cursor.next(ec);
+        }
+        finished = true;
+    }
+
+    fire_and_forget read_document(async_json_cursor& cursor, json& result)
+    {
+        co_await cursor.next();
+        json_decoder<json> decoder;
+        co_await cursor.read_to(decoder);
+        result = decoder.get_result();
+    }
+
+} // namespace
+
+TEST_CASE("async_json_cursor with coroutines")
+{
+    std::string input = R"([{"name": "a"}, {"name": "b"}, {"name": "c"}])";
+
+    SECTION("next")
+    {
+        std::deque<std::function<void()>> loop;
+        chunked_source source(input, 4, &loop);
+        async_json_cursor cursor(source);
+        std::vector<std::string> names;
+        std::error_code ec;
+        bool finished = false;
+        read_names(cursor, names, ec, finished);
+        CHECK_FALSE(finished);
+        run(loop);
+        CHECK(finished);
+        CHECK_FALSE(ec);
+        CHECK(names == std::vector<std::string>{"a", "b", "c"});
+    }
+
+    SECTION("read_to")
+    {
+        std::deque<std::function<void()>> loop;
+        chunked_source source(input, 4, &loop);
+        async_json_cursor cursor(source);
+        json result;
+        read_document(cursor, result);
+        run(loop);
+        CHECK(result == json::parse(input));
+    }
+}
+
+#endif // defined(JSONCONS_HAS_COROUTINES)
@@ -5,10 +5,57 @@
 #include <catch/catch.hpp>
 #include <vector>
 #include <map>
+#include <sstream>
 #include <utility>
 
 using namespace jsoncons;
 
+namespace decode_traits_tests {
+
+    struct order_line
+    {
+        std::string sku;
+        int quantity;
+        double price;
+    };
+
+    struct order
+    {
+        uint64_t id;
+        std::string customer;
+        std::vector<order_line> lines;
+        std::map<std::string,std::string> attributes;
+        jsoncons::optional<std::string> note;
+    };
+
+    struct label
+    {
+        const std::string kind = "label";
+        std::string text;
+    };
+
+    struct settings
+    {
+        std::string name;
+        int retries = 3;
+        std::vector<std::string> tags;
+    };
+
+    struct city_view
+    {
+        jsoncons::string_view name;
+        jsoncons::string_view country;
+        std::vector<jsoncons::string_view> districts;
+    };
+
+} // namespace decode_traits_tests
+
+JSONCONS_ALL_MEMBER_TRAITS(decode_traits_tests::order_line, sku, quantity, price)
+JSONCONS_N_MEMBER_TRAITS(decode_traits_tests::order, 3, id, customer, lines, attributes, note)
+JSONCONS_ALL_MEMBER_TRAITS(decode_traits_tests::label, kind, text)
+JSONCONS_N_MEMBER_TRAITS(decode_traits_tests::settings, 1, name, retries, tags)
+JSONCONS_ALL_MEMBER_TRAITS(decode_traits_tests::city_view, name, country, districts)
+
 TEST_CASE("decode_traits primitive")
 {
     SECTION("is_primitive")
@@ -149,3 +196,232 @@ TEST_CASE("decode_traits deserialization errors")
         CHECK(ec == json_errc::expected_comma_or_right_brace);
     }
 }
+
+TEST_CASE("decode_traits macro mapped types")
+{
+    using decode_traits_tests::order;
+
+    SECTION("nested types, unknown members skipped")
+    {
+        std::string input = R"(
+{
+    "id" : 10,
+    "extra" : {"a" : [1,{"b" : null}], "c" : "d"},
+    "customer" : "Acme",
+    "lines" : [{"sku" : "A-1", "quantity" : 2, "price" : 9.5, "extra" : [1,2]},
+               {"price" : 1.25, "sku" : "B-2", "quantity" : 1}],
+    "attributes" : {"priority" : "high"},
+    "note" : "rush"
+}
+        )";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        auto val = decode_traits<order,char>::decode(cursor,decoder,ec);
+
+        REQUIRE_FALSE(ec);
+        CHECK_FALSE(decoder.is_valid()); // no intermediate json value
+        CHECK(val.id == 10);
+        CHECK(val.customer == "Acme");
+        REQUIRE(val.lines.size() == 2);
+        CHECK(val.lines[0].sku == "A-1");
+        CHECK(val.lines[0].quantity == 2);
+        CHECK(val.lines[0].price == 9.5);
+        CHECK(val.lines[1].sku == "B-2");
+        CHECK(val.lines[1].price == 1.25);
+        CHECK(val.attributes.at("priority") == "high");
+        REQUIRE(val.note);
+        CHECK(*val.note == "rush");
+    }
+    SECTION("optional members absent or null")
+    {
+        std::string input = R"({"id":1,"customer":"Acme","lines":[],"note":null})";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        auto val = decode_traits<order,char>::decode(cursor,decoder,ec);
+
+        REQUIRE_FALSE(ec);
+        CHECK(val.attributes.empty());
+        CHECK_FALSE(val.note);
+    }
+    SECTION("missing mandatory member")
+    {
+        std::string input = R"({"id":1,"lines":[]})";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        decode_traits<order,char>::decode(cursor,decoder,ec);
+
+        CHECK(ec == conv_errc::missing_required_member);
+    }
+    SECTION("missing mandatory member in array element")
+    {
+        std::string input = R"([{"id":1,"customer":"Acme","lines":[{"sku":"A-1","quantity":2}]}])";
+
+        CHECK_THROWS_AS(decode_json<std::vector<order>>(input), ser_error);
+    }
+    SECTION("not an object")
+    {
+        std::string input = R"([1,2])";
+
+        json_decoder<json> decoder;
+        std::error_code ec;
+
+        json_cursor cursor(input);
+        decode_traits<order,char>::decode(cursor,decoder,ec);
+
+        CHECK(ec == conv_errc::conversion_failed);
+    }
+    SECTION("decode_json vector")
+    {
+        std::string input = R"([{"id":1,"customer":"Acme","lines":[]},{"id":2,"customer":"Bolt","lines":[{"sku":"C-3","quantity":4,"price":2.0}]}])";
+
+        auto val = decode_json<std::vector<order>>(input);
+
+        REQUIRE(val.size() == 2);
+        CHECK(val[0].customer == "Acme");
+        CHECK(val[1].id == 2);
+        REQUIRE(val[1].lines.size() == 1);
+        CHECK(val[1].lines[0].quantity == 4);
+    }
+    SECTION("const members read past")
+    {
+        std::string input = R"([{"kind":{"a":[1,2]},"text":"x"},{"kind":"other","text":"y"}])";
+
+        auto val = decode_json<std::vector<decode_traits_tests::label>>(input);
+
+        REQUIRE(val.size() == 2);
+        CHECK(val[0].kind == "label");
+        CHECK(val[0].text == "x");
+        CHECK(val[1].kind == "label");
+        CHECK(val[1].text == "y");
+    }
+    SECTION("wide characters")
+    {
+        std::wstring input = LR"([{"sku":"A-1","quantity":2,"price":9.5}])";
+
+        json_decoder<wjson> decoder;
+        std::error_code ec;
+
+        wjson_cursor cursor(input);
+        auto val = decode_traits<std::vector<decode_traits_tests::order_line>,wchar_t>::decode(cursor,decoder,ec);
+
+        REQUIRE_FALSE(ec);
+        REQUIRE(val.size() == 1);
+        CHECK(val[0].sku == "A-1");
+        CHECK(val[0].quantity == 2);
+    }
+}
+
+TEST_CASE("decode_json_into")
+{
+    using decode_traits_tests::order;
+    using decode_traits_tests::settings;
+
+    SECTION("storage reused")
+    {
+        std::string input1 = R"({"id":1,"customer":"A customer with a long name","lines":[{"sku":"A-1","quantity":2,"price":1.0},{"sku":"B-2","quantity":1,"price":2.0},{"sku":"C-3","quantity":1,"price":3.0}],"note":"rush"})";
+        std::string input2 = R"({"id":2,"customer":"Acme","lines":[{"sku":"D-4","quantity":5,"price":4.0}]})";
+
+        order val;
+        decode_json_into(input1, val);
+        REQUIRE(val.lines.size() == 3);
+        REQUIRE(val.note);
+
+        const decode_traits_tests::order_line* lines_data = val.lines.data();
+        const std::size_t customer_capacity = val.customer.capacity();
+
+        decode_json_into(input2, val);
+        CHECK(val.id == 2);
+        CHECK(val.customer == "Acme");
+        CHECK(val.customer.capacity() == customer_capacity);
+        REQUIRE(val.lines.size() == 1);
+        CHECK(val.lines.data() == lines_data);
+        CHECK(val.lines[0].sku == "D-4");
+        CHECK(val.lines[0].quantity == 5);
+        CHECK_FALSE(val.note); // absent, reset
+    }
+
+    SECTION("absent members get their defaults")
+    {
+        settings val;
+        decode_json_into(std::string(R"({"name":"a","retries":5,"tags":["x","y"]})"), val);
+        CHECK(val.retries == 5);
+        CHECK(val.tags.size() == 2);
+
+        decode_json_into(std::string(R"({"name":"b"})"), val);
+        CHECK(val.name == "b");
+        CHECK(val.retries == 3);
+        CHECK(val.tags.empty());
+    }
+
+    SECTION("vector of classes from a stream")
+    {
+        std::vector<settings> val;
+        std::istringstream is1(R"([{"name":"a"},{"name":"b"}])");
+        decode_json_into(is1, val);
+        REQUIRE(val.size() == 2);
+
+        std::istringstream is2(R"([{"name":"c","tags":["t"]}])");
+        decode_json_into(is2, val);
+        REQUIRE(val.size() == 1);
+        CHECK(val[0].name == "c");
+        CHECK(val[0].tags.size() == 1);
+    }
+
+    SECTION("missing mandatory member")
+    {
+        settings val;
+        CHECK_THROWS_AS(decode_json_into(std::string(R"({"retries":5})"), val), ser_error);
+    }
+}
+
+TEST_CASE("decode_json string view members")
+{
+    using decode_traits_tests::city_view;
+
+    auto within = [](const jsoncons::string_view& sv, const std::string& s) -> bool
+    {
+        return sv.data() >= s.data() && sv.data() + sv.size() <= s.data() + s.size();
+    };
+
+    SECTION("borrowed from the source")
+    {
+        std::string s = R"({"name":"Lyon","country":"France","districts":["Vaise","Croix-Rousse"]})";
+        auto val = decode_json<city_view>(s, json_options{}.borrow_strings(true));
+        CHECK(val.name == "Lyon");
+        CHECK(within(val.name, s));
+        CHECK(within(val.country, s));
+        REQUIRE(val.districts.size() == 2);
+        CHECK(val.districts[1] == "Croix-Rousse");
+        CHECK(within(val.districts[1], s));
+    }
+
+    SECTION("escaped strings are copied into the arena")
+    {
+        std::string s = R"({"name":"Saint-\u00C9tienne","country":"France","districts":[]})";
+        string_arena arena;
+        auto val = decode_json<city_view>(s, arena, json_options{}.borrow_strings(true));
+        CHECK(val.name == "Saint-\xC3\x89tienne");
+        CHECK_FALSE(within(val.name, s));
+        CHECK(within(val.country, s));
+
+        CHECK_THROWS_AS(decode_json<city_view>(s, json_options{}.borrow_strings(true)), ser_error);
+    }
+
+    SECTION("not borrowable")
+    {
+        std::string s = R"({"name":"Lyon","country":"France","districts":[]})";
+        CHECK_THROWS_AS(decode_json<city_view>(s), ser_error);
+
+        std::istringstream is(s);
+        CHECK_THROWS_AS(decode_json<city_view>(is, json_options{}.borrow_strings(true)), ser_error);
+    }
+}
@@ -0,0 +1,62 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/detail/name_index.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using jsoncons::detail::name_index;
+
+TEST_CASE("detail::name_index tests")
+{
+    SECTION("all names found at their positions")
+    {
+        std::vector<std::string> strings;
+        for (std::size_t i = 0; i < 50; ++i)
+        {
+            strings.push_back("field" + std::to_string(i));
+        }
+        std::vector<const char*> names;
+        for (const auto& s : strings)
+        {
+            names.push_back(s.c_str());
+        }
+        name_index<char> index(names);
+
+        REQUIRE(index.size() == 50);
+        for (std::size_t i = 0; i < strings.size(); ++i)
+        {
+            CHECK(index.find(strings[i].data(), strings[i].size()) == i);
+        }
+        std::string unknown = "field50";
+        CHECK(index.find(unknown.data(), unknown.size()) == index.npos);
+        CHECK(index.find("field1", 5) == index.npos); // prefix
+        CHECK(index.find("", 0) == index.npos);
+    }
+    SECTION("empty set")
+    {
+        name_index<char> index(std::vector<const char*>{});
+
+        CHECK(index.size() == 0);
+        CHECK(index.find("a", 1) == index.npos);
+    }
+    SECTION("repeated and empty names")
+    {
+        const char* names[] = {"a", "", "b", "a"};
+        name_index<char> index(names, 4);
+
+        CHECK(index.find("a", 1) == 0);
+        CHECK(index.find("", 0) == 1);
+        CHECK(index.find("b", 1) == 2);
+    }
+    SECTION("wide characters")
+    {
+        const wchar_t* names[] = {L"author", L"title", L"price"};
+        name_index<wchar_t> index(names, 3);
+
+        CHECK(index.find(L"price", 5) == 2);
+        CHECK(index.find(L"title", 5) == 1);
+        CHECK(index.find(L"isbn", 4) == index.npos);
+    }
+}
@@ -6,6 +6,8 @@
 #endif
 #include <catch/catch.hpp>
 #include <jsoncons/json.hpp>
+#include <map>
+#include <memory>
 #include <vector>
 
 using jsoncons::json_type_traits;
@@ -31,11 +33,43 @@ namespace encode_traits_tests {
         {
         }
     };
+
+    struct reading
+    {
+        std::string sensor;
+        jsoncons::optional<double> value;
+    };
+
+    struct response
+    {
+        int id;
+        std::vector<book> items;
+        std::map<std::string,int> counts;
+        jsoncons::optional<std::string> note;
+        std::shared_ptr<reading> last;
+    };
+
+    class object_length_visitor : public jsoncons::default_json_visitor
+    {
+    public:
+        std::vector<std::size_t> lengths;
+    private:
+        bool visit_begin_object(std::size_t length, 
+                                jsoncons::semantic_tag, 
+                                const jsoncons::ser_context&, 
+                                std::error_code&) override
+        {
+            lengths.push_back(length);
+            return true;
+        }
+    };
 } // namespace encode_traits_tests
 
 namespace ns = encode_traits_tests;
 
 JSONCONS_ALL_MEMBER_TRAITS(ns::book,author,title,price)
+JSONCONS_ALL_MEMBER_TRAITS(ns::reading,sensor,value)
+JSONCONS_N_MEMBER_TRAITS(ns::response,2,id,items,counts,note,last)
 
 TEST_CASE("decode_traits string tests")
 {
@@ -130,3 +164,60 @@ TEST_CASE("decode_traits std::pair tests")
     }
 }
 
+
+TEST_CASE("encode_traits macro mapped types")
+{
+    ns::response val;
+    val.id = 1;
+    val.items.emplace_back("Haruki Murakami","Kafka on the Shore",25.17);
+    val.counts["b"] = 2;
+    val.counts["a"] = 1;
+
+    SECTION("members in declaration order, absent optional members omitted")
+    {
+        std::string buf;
+        encode_json(val, buf);
+
+        CHECK(buf == R"({"id":1,"items":[{"author":"Haruki Murakami","title":"Kafka on the Shore","price":25.17}],"counts":{"a":1,"b":2}})");
+    }
+    SECTION("optional members present")
+    {
+        val.note = std::string("first");
+        val.last = std::make_shared<ns::reading>();
+        val.last->sensor = "t1";
+
+        std::string buf;
+        encode_json(val, buf);
+
+        CHECK(buf == R"({"id":1,"items":[{"author":"Haruki Murakami","title":"Kafka on the Shore","price":25.17}],"counts":{"a":1,"b":2},"note":"first","last":{"sensor":"t1","value":null}})");
+
+        auto val2 = decode_json<ns::response>(buf);
+        CHECK(val2.id == 1);
+        REQUIRE(val2.note);
+        CHECK(*val2.note == "first");
+        REQUIRE(val2.last);
+        CHECK(val2.last->sensor == "t1");
+        CHECK_FALSE(val2.last->value);
+    }
+    SECTION("object lengths")
+    {
+        val.note = std::string("first");
+
+        ns::object_length_visitor visitor;
+        std::error_code ec;
+        jsoncons::encode_traits<ns::response,char>::encode(val, visitor, json(), ec);
+
+        REQUIRE_FALSE(ec);
+        REQUIRE(visitor.lengths.size() == 3);
+        CHECK(visitor.lengths[0] == 4);
+        CHECK(visitor.lengths[1] == 3);
+        CHECK(visitor.lengths[2] == 2);
+    }
+    SECTION("wide characters")
+    {
+        std::wstring buf;
+        encode_json(val.items[0], buf);
+
+        CHECK(buf == LR"({"author":"Haruki Murakami","title":"Kafka on the Shore","price":25.17})");
+    }
+}
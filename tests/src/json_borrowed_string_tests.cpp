@@ -0,0 +1,271 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+
+using namespace jsoncons;
+
+namespace {
+
+    // Interchangeable allocators that remember where they came from
+    template <class T>
+    struct tagged_allocator
+    {
+        using value_type = T;
+
+        int id;
+
+        tagged_allocator() noexcept : id(0) {}
+        explicit tagged_allocator(int n) noexcept : id(n) {}
+        template <class U>
+        tagged_allocator(const tagged_allocator<U>& other) noexcept : id(other.id) {}
+
+        T* allocate(std::size_t n) { return static_cast<T*>(::operator new(n * sizeof(T))); }
+        void deallocate(T* p, std::size_t) noexcept { ::operator delete(p); }
+
+        friend bool operator==(const tagged_allocator&, const tagged_allocator&) noexcept { return true; }
+        friend bool operator!=(const tagged_allocator&, const tagged_allocator&) noexcept { return false; }
+    };
+
+} // namespace
+
+TEST_CASE("json borrowed string storage tests")
+{
+    std::string s = "Too long to fit in small string";
+
+    SECTION("borrowed string")
+    {
+        json j(borrowed_string_arg, s);
+        CHECK(j.storage() == storage_kind::borrowed_string_value);
+        CHECK(j.is_string());
+        CHECK(j.as_string_view().data() == s.data());
+        CHECK(j.as<std::string>() == s);
+        CHECK(j == json(s));
+        CHECK(json(s) == j);
+        CHECK_FALSE(j.empty());
+    }
+
+    SECTION("short string is copied")
+    {
+        std::string small = "Small string";
+        json j(borrowed_string_arg, small);
+        CHECK(j.storage() == storage_kind::short_string_value);
+        CHECK(j.as<std::string>() == small);
+    }
+
+    SECTION("copy and swap")
+    {
+        json j(borrowed_string_arg, s);
+        json k(j);
+        CHECK(k.storage() == storage_kind::borrowed_string_value);
+        CHECK(k.as_string_view().data() == s.data());
+
+        json other(10);
+        other.swap(k);
+        CHECK(other.storage() == storage_kind::borrowed_string_value);
+        CHECK(k.as<int>() == 10);
+    }
+
+    SECTION("materialize")
+    {
+        json j(borrowed_string_arg, s);
+        j.materialize();
+        CHECK(j.storage() == storage_kind::long_string_value);
+        CHECK(j.as_string_view().data() != s.data());
+        CHECK(j.as<std::string>() == s);
+    }
+
+    SECTION("compare with other kinds")
+    {
+        json j(borrowed_string_arg, s);
+        json n(10);
+        json a(json_array_arg);
+        CHECK((n < j) == (n < json(s)));
+        CHECK((j < n) == (json(s) < n));
+        CHECK((j < a) == (json(s) < a));
+        CHECK((a < j) == (a < json(s)));
+        CHECK(j.compare(json(s)) == 0);
+        CHECK(json(s).compare(j) == 0);
+        CHECK(j.compare(json("Zzz")) < 0);
+        CHECK(json("Zzz").compare(j) > 0);
+    }
+
+    SECTION("not a cstring")
+    {
+        json j(borrowed_string_arg, s);
+        CHECK_FALSE(j.is<const char*>());
+        CHECK(j.is<std::string>());
+        CHECK(j.is<jsoncons::string_view>());
+        REQUIRE_THROWS(j.as_cstring());
+
+        j.materialize();
+        CHECK(j.is<const char*>());
+        CHECK(std::string(j.as<const char*>()) == s);
+    }
+}
+
+TEST_CASE("json borrowed string allocator tests")
+{
+    using my_json = basic_json<char,sorted_policy,tagged_allocator<char>>;
+
+    std::string s = "Too long to fit in small string";
+
+    SECTION("materialize with allocator")
+    {
+        my_json j(borrowed_string_arg, s);
+        j.materialize(tagged_allocator<char>(1));
+        CHECK(j.storage() == storage_kind::long_string_value);
+        CHECK(j.get_allocator().id == 1);
+    }
+
+    SECTION("nested strings use the container allocator")
+    {
+        my_json a(json_array_arg, semantic_tag::none, tagged_allocator<char>(2));
+        a.push_back(my_json(borrowed_string_arg, s));
+        my_json o(json_object_arg, semantic_tag::none, tagged_allocator<char>(3));
+        o.try_emplace("field", my_json(borrowed_string_arg, s));
+
+        my_json a_copy = deep_copy(a);
+        CHECK(a_copy[0].storage() == storage_kind::long_string_value);
+        CHECK(a_copy[0].get_allocator().id == 2);
+
+        a.materialize();
+        o.materialize();
+        CHECK(a[0].get_allocator().id == 2);
+        CHECK(o["field"].get_allocator().id == 3);
+    }
+
+    SECTION("decoder result allocator")
+    {
+        std::string input = "[\"" + s + "\"]";
+
+        json_decoder<my_json> decoder(result_allocator_arg, tagged_allocator<char>(4));
+        decoder.borrow_strings_from(input);
+        json_reader reader(input, decoder);
+        reader.read();
+        my_json j = decoder.get_result();
+        CHECK(j[0].storage() == storage_kind::borrowed_string_value);
+
+        j[0].materialize(j.get_allocator());
+        CHECK(j[0].get_allocator().id == 4);
+    }
+}
+
+TEST_CASE("json parse with borrow_strings")
+{
+    std::string input = R"(
+{
+    "title" : "A string long enough to be borrowed",
+    "escaped" : "A string with an \"escape\" is copied",
+    "short" : "small",
+    "items" : ["Another string long enough to be borrowed", 1, 2.5]
+}
+    )";
+
+    auto options = json_options{}.borrow_strings(true);
+
+    SECTION("json::parse")
+    {
+        json j = json::parse(input, options);
+
+        const json& title = j["title"];
+        CHECK(title.storage() == storage_kind::borrowed_string_value);
+        CHECK(title.as_string_view().data() >= input.data());
+        CHECK(title.as_string_view().data() < input.data() + input.size());
+        CHECK(title.as<std::string>() == "A string long enough to be borrowed");
+
+        CHECK(j["escaped"].storage() == storage_kind::long_string_value);
+        CHECK(j["escaped"].as<std::string>() == "A string with an \"escape\" is copied");
+        CHECK(j["short"].storage() == storage_kind::short_string_value);
+        CHECK(j["items"][0].storage() == storage_kind::borrowed_string_value);
+
+        json expected = json::parse(input);
+        CHECK(j == expected);
+    }
+
+    SECTION("decode_json")
+    {
+        json j = decode_json<json>(input, options);
+        CHECK(j["title"].storage() == storage_kind::borrowed_string_value);
+        CHECK(j["items"][0].storage() == storage_kind::borrowed_string_value);
+    }
+
+    SECTION("deep_copy and materialize")
+    {
+        json j = json::parse(input, options);
+
+        json copy = deep_copy(j);
+        CHECK(copy["title"].storage() == storage_kind::long_string_value);
+        CHECK(copy["items"][0].storage() == storage_kind::long_string_value);
+        CHECK(copy == j);
+
+        j.materialize();
+        CHECK(j["title"].storage() == storage_kind::long_string_value);
+        CHECK(j["items"][0].storage() == storage_kind::long_string_value);
+
+        input.assign(input.size(), ' ');
+        CHECK(j["title"].as<std::string>() == "A string long enough to be borrowed");
+    }
+
+    SECTION("default is to copy")
+    {
+        json j = json::parse(input);
+        CHECK(j["title"].storage() == storage_kind::long_string_value);
+    }
+
+    SECTION("stream source is copied")
+    {
+        std::istringstream is(input);
+        json j = json::parse(is, options);
+        CHECK(j["title"].storage() == storage_kind::long_string_value);
+    }
+
+    SECTION("temporary source is copied")
+    {
+        json j = json::parse(std::string(input), options);
+        CHECK(j["title"].storage() == storage_kind::long_string_value);
+        CHECK(j["items"][0].storage() == storage_kind::long_string_value);
+
+        json k = decode_json<json>(std::string(input), options);
+        CHECK(k["title"].storage() == storage_kind::long_string_value);
+        CHECK(k == j);
+    }
+
+    SECTION("string_view source is borrowed")
+    {
+        json j = json::parse(jsoncons::string_view(input), options);
+        CHECK(j["title"].storage() == storage_kind::borrowed_string_value);
+    }
+
+    SECTION("decoder reset forgets the source")
+    {
+        json_decoder<json> decoder;
+        decoder.borrow_strings_from(input);
+        decoder.reset();
+
+        json_reader reader(input, decoder);
+        reader.read();
+        json j = decoder.get_result();
+        CHECK(j["title"].storage() == storage_kind::long_string_value);
+    }
+
+    SECTION("get_result forgets the source")
+    {
+        json_decoder<json> decoder;
+        decoder.borrow_strings_from(input);
+        json_reader reader(input, decoder);
+        reader.read();
+        json j = decoder.get_result();
+        CHECK(j["title"].storage() == storage_kind::borrowed_string_value);
+
+        std::string other = input;
+        json_reader reader2(other, decoder);
+        reader2.read();
+        json k = decoder.get_result();
+        CHECK(k["title"].storage() == storage_kind::long_string_value);
+    }
+}
+
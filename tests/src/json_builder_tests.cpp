@@ -0,0 +1,166 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json object_builder tests")
+{
+    SECTION("members in any order")
+    {
+        json::object_builder builder;
+        builder.insert("c", 3);
+        builder.insert("a", 1);
+        builder.emplace("b", json_array_arg);
+        CHECK(builder.size() == 3);
+
+        json j = builder.build();
+        CHECK(builder.empty());
+        CHECK(j == json::parse(R"({"a":1,"b":[],"c":3})"));
+        CHECK(j.object_range().begin()->key() == "a");
+        CHECK(j.contains("b"));
+    }
+
+    SECTION("duplicates, last wins")
+    {
+        json::object_builder builder(5);
+        builder.insert("b", 1);
+        builder.insert("a", 2);
+        builder.insert("b", 3);
+        builder.insert("a", 4);
+        builder.insert("b", 5);
+
+        json j = builder.build();
+        CHECK(j == json::parse(R"({"a":4,"b":5})"));
+    }
+
+    SECTION("duplicates, first wins")
+    {
+        json::object_builder builder;
+        builder.insert("b", 1);
+        builder.insert("a", 2);
+        builder.insert("b", 3);
+        builder.insert("a", 4);
+
+        json j = builder.build(duplicate_key_policy::first_wins);
+        CHECK(j == json::parse(R"({"a":2,"b":1})"));
+    }
+
+    SECTION("empty")
+    {
+        json::object_builder builder;
+        json j = builder.build();
+        CHECK(j.is_object());
+        CHECK(j.empty());
+    }
+
+    SECTION("builder is reusable")
+    {
+        json::object_builder builder;
+        builder.insert("x", 1);
+        json j1 = builder.build();
+        builder.insert("y", 2);
+        json j2 = builder.build();
+        CHECK(j1 == json::parse(R"({"x":1})"));
+        CHECK(j2 == json::parse(R"({"y":2})"));
+    }
+
+    SECTION("many keys")
+    {
+        const std::size_t n = 10000;
+        json::object_builder builder(n + n/10);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            builder.insert(std::to_string((i * 7919) % n), i);
+        }
+        for (std::size_t i = 0; i < n/10; ++i)
+        {
+            builder.insert(std::to_string(i), "replaced");
+        }
+        json j = builder.build();
+        REQUIRE(j.size() == n);
+        CHECK(j["5"].as<std::string>() == "replaced");
+        CHECK(j[std::to_string(n-1)].is_number());
+
+        std::string previous;
+        for (const auto& member : j.object_range())
+        {
+            CHECK(previous < member.key());
+            previous = member.key();
+        }
+    }
+}
+
+TEST_CASE("ojson object_builder tests")
+{
+    SECTION("keeps the order of first insertion")
+    {
+        ojson::object_builder builder;
+        builder.insert("c", 1);
+        builder.insert("a", 2);
+        builder.insert("c", 3);
+        builder.insert("b", 4);
+
+        ojson j = builder.build();
+        REQUIRE(j.size() == 3);
+        auto it = j.object_range().begin();
+        CHECK(it->key() == "c");
+        CHECK(it->value().as<int>() == 3);
+        ++it;
+        CHECK(it->key() == "a");
+        ++it;
+        CHECK(it->key() == "b");
+        CHECK(j["b"].as<int>() == 4);
+    }
+
+    SECTION("first wins")
+    {
+        ojson::object_builder builder;
+        builder.insert("c", 1);
+        builder.insert("a", 2);
+        builder.insert("c", 3);
+
+        ojson j = builder.build(duplicate_key_policy::first_wins);
+        CHECK(j == ojson::parse(R"({"c":1,"a":2})"));
+        CHECK(j["c"].as<int>() == 1);
+    }
+}
+
+TEST_CASE("json array_builder tests")
+{
+    json::array_builder builder(3);
+    builder.push_back(1);
+    builder.emplace_back("two");
+    builder.push_back(json(json_object_arg));
+    CHECK(builder.size() == 3);
+
+    json j = builder.build();
+    CHECK(builder.empty());
+    CHECK(j == json::parse(R"([1,"two",{}])"));
+
+    builder.push_back(true);
+    CHECK(builder.build() == json::parse("[true]"));
+}
+
+TEST_CASE("json insert sorted_unique_range_tag tests")
+{
+    std::vector<std::pair<std::string,json>> members = {{"a",json(1)},{"b",json(2)},{"c",json(3)}};
+
+    SECTION("into empty object")
+    {
+        json j(json_object_arg);
+        j.insert(sorted_unique_range_tag(), std::make_move_iterator(members.begin()), std::make_move_iterator(members.end()));
+        CHECK(j == json::parse(R"({"a":1,"b":2,"c":3})"));
+    }
+
+    SECTION("into object with members")
+    {
+        json j = json::parse(R"({"b":20,"d":4})");
+        j.insert(sorted_unique_range_tag(), members.begin(), members.end());
+        CHECK(j == json::parse(R"({"a":1,"b":20,"c":3,"d":4})"));
+    }
+}
@@ -518,11 +518,11 @@ TEST_CASE("staj event as object")
         cursor.next();
         CHECK(cursor.current().event_type() == staj_event_type::key);
         cursor.next();
-        CHECK(cursor.current().event_type() == staj_event_type::double_value);
+        CHECK(cursor.current().event_type() == staj_event_type::string_value);
         cursor.next();
         CHECK(cursor.current().event_type() == staj_event_type::key);
         cursor.next();
-        CHECK(cursor.current().event_type() == staj_event_type::string_value);
+        CHECK(cursor.current().event_type() == staj_event_type::double_value);
         cursor.next();
         CHECK(cursor.current().event_type() == staj_event_type::end_object);
         cursor.next();
@@ -534,11 +534,11 @@ TEST_CASE("staj event as object")
         cursor.next();
         CHECK(cursor.current().event_type() == staj_event_type::key);
         cursor.next();
-        CHECK(cursor.current().event_type() == staj_event_type::double_value);
+        CHECK(cursor.current().event_type() == staj_event_type::string_value);
         cursor.next();
         CHECK(cursor.current().event_type() == staj_event_type::key);
         cursor.next();
-        CHECK(cursor.current().event_type() == staj_event_type::string_value);
+        CHECK(cursor.current().event_type() == staj_event_type::double_value);
         cursor.next();
         CHECK(cursor.current().event_type() == staj_event_type::end_object);
         cursor.next();
@@ -570,3 +570,185 @@ TEST_CASE("staj event as object")
     }
 }
 
+
+TEST_CASE("json_cursor skip tests")
+{
+    std::string s = R"(
+{
+    "a" : {"x" : [1, "]}", {"y" : "\"}"}], "z" : {}},
+    "b" : [1, 2, [3, 4], {"c" : 5}],
+    "c" : "found"
+}
+)";
+
+    SECTION("skip members")
+    {
+        json_cursor cursor(s);
+        cursor.next();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == std::string("a"));
+        cursor.skip();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == std::string("b"));
+        CHECK(cursor.context().line() == 4);
+        cursor.skip();
+        REQUIRE(cursor.current().event_type() == staj_event_type::key);
+        CHECK(cursor.current().get<std::string>() == std::string("c"));
+        cursor.skip();
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+        cursor.next();
+        CHECK(cursor.done());
+    }
+
+    SECTION("skip document")
+    {
+        json_cursor cursor(s);
+        cursor.skip();
+        CHECK(cursor.done());
+    }
+
+    SECTION("skip_to_key")
+    {
+        json_cursor cursor(s);
+        CHECK(cursor.skip_to_key("c"));
+        CHECK(cursor.current().event_type() == staj_event_type::string_value);
+        CHECK(cursor.current().get<std::string>() == std::string("found"));
+    }
+
+    SECTION("skip_to_key not found")
+    {
+        json_cursor cursor(s);
+        CHECK_FALSE(cursor.skip_to_key("d"));
+        CHECK(cursor.current().event_type() == staj_event_type::end_object);
+    }
+
+    SECTION("skip_to_index")
+    {
+        json_cursor cursor(s);
+        REQUIRE(cursor.skip_to_key("b"));
+        CHECK(cursor.skip_to_index(3));
+        REQUIRE(cursor.current().event_type() == staj_event_type::begin_object);
+        CHECK(cursor.skip_to_key("c"));
+        CHECK(cursor.current().get<int>() == 5);
+    }
+
+    SECTION("skip_to_index out of range")
+    {
+        json_cursor cursor(s);
+        REQUIRE(cursor.skip_to_key("b"));
+        CHECK_FALSE(cursor.skip_to_index(4));
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+    }
+
+    SECTION("small buffers")
+    {
+        std::istringstream is(s);
+        json_cursor cursor(is);
+        cursor.buffer_length(3);
+        CHECK(cursor.skip_to_key("c"));
+        CHECK(cursor.current().get<std::string>() == std::string("found"));
+        CHECK(cursor.context().line() == 5);
+    }
+}
+
+TEST_CASE("json_cursor skip with comments")
+{
+    std::string s = R"({"a" : [1, /* ] */ 2, // }
+                              3], "b" : true})";
+
+    json_cursor cursor(s);
+    CHECK(cursor.skip_to_key("b"));
+    CHECK(cursor.current().event_type() == staj_event_type::bool_value);
+    CHECK(cursor.context().line() == 2);
+}
+
+TEST_CASE("json_cursor skip errors")
+{
+    SECTION("mismatched bracket")
+    {
+        std::string s = R"({"a" : [1, 2}, "b" : 3})";
+        json_cursor cursor(s);
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == json_errc::expected_comma_or_right_bracket);
+    }
+    SECTION("unexpected eof")
+    {
+        std::string s = R"({"a" : [1, 2, "]")";
+        json_cursor cursor(s);
+        cursor.next();
+        std::error_code ec;
+        cursor.skip(ec);
+        CHECK(ec == json_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("json_cursor bookmark and seek tests")
+{
+    std::string s = R"(
+[
+    {"id" : 1, "name" : "one", "tags" : ["a", "b"]},
+    {"id" : 2, "name" : "two \"2\"", "tags" : []},
+    {"id" : 3, "name" : "three", "tags" : [{"x" : -1.5e3}]}
+]
+)";
+    json document = json::parse(s);
+
+    SECTION("string")
+    {
+        json_cursor cursor(s);
+        std::vector<json_cursor::bookmark_type> bookmarks;
+        cursor.next();
+        while (cursor.current().event_type() == staj_event_type::begin_object)
+        {
+            bookmarks.push_back(cursor.bookmark());
+            cursor.skip();
+        }
+        REQUIRE(bookmarks.size() == 3);
+        CHECK(s[bookmarks[1].offset()-1] == '{');
+
+        for (std::size_t i : {2, 0, 1})
+        {
+            cursor.seek(bookmarks[i]);
+            CHECK(cursor.current().event_type() == staj_event_type::begin_object);
+            CHECK(cursor.context().line() == i + 3);
+            json_decoder<json> decoder;
+            cursor.read_to(decoder);
+            CHECK(decoder.get_result() == document[i]);
+        }
+    }
+
+    SECTION("stream")
+    {
+        std::istringstream is(s);
+        json_cursor cursor(is);
+        cursor.buffer_length(7);
+        std::vector<json_cursor::bookmark_type> bookmarks;
+        cursor.next();
+        while (cursor.current().event_type() == staj_event_type::begin_object)
+        {
+            REQUIRE(cursor.skip_to_key("name"));
+            bookmarks.push_back(cursor.bookmark());
+            cursor.next();
+            cursor.skip();
+            cursor.next();
+        }
+        REQUIRE(bookmarks.size() == 3);
+        cursor.next();
+        CHECK(cursor.done());
+
+        for (std::size_t i : {1, 2, 0})
+        {
+            cursor.seek(bookmarks[i]);
+            REQUIRE(cursor.current().event_type() == staj_event_type::string_value);
+            CHECK(cursor.current().get<std::string>() == document[i]["name"].as<std::string>());
+            cursor.next();
+            CHECK(cursor.current().get<std::string>() == std::string("tags"));
+        }
+        cursor.next();
+        json_decoder<json> decoder;
+        cursor.read_to(decoder);
+        CHECK(decoder.get_result() == document[0]["tags"]);
+    }
+}
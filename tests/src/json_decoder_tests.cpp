@@ -0,0 +1,133 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json_decoder length hint tests")
+{
+    SECTION("object with length")
+    {
+        json_decoder<json> decoder;
+        decoder.begin_object(3, semantic_tag::none, ser_context());
+        decoder.key("c", ser_context());
+        decoder.uint64_value(3, semantic_tag::none, ser_context());
+        decoder.key("a", ser_context());
+        decoder.uint64_value(1, semantic_tag::none, ser_context());
+        decoder.key("b", ser_context());
+        decoder.begin_array(2, semantic_tag::none, ser_context());
+        decoder.bool_value(true, semantic_tag::none, ser_context());
+        decoder.null_value(semantic_tag::none, ser_context());
+        decoder.end_array(ser_context());
+        decoder.end_object(ser_context());
+
+        REQUIRE(decoder.is_valid());
+        json j = decoder.get_result();
+        CHECK(j == json::parse(R"({"a":1,"b":[true,null],"c":3})"));
+    }
+
+    SECTION("length hint smaller than actual")
+    {
+        json_decoder<json> decoder;
+        decoder.begin_array(1, semantic_tag::none, ser_context());
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            decoder.uint64_value(i, semantic_tag::none, ser_context());
+        }
+        decoder.end_array(ser_context());
+
+        json j = decoder.get_result();
+        REQUIRE(j.size() == 100);
+        CHECK(j[99].as<int>() == 99);
+    }
+
+    SECTION("untrusted length in truncated cbor")
+    {
+        // map with 2^32-1 pairs, followed by one pair only
+        std::vector<uint8_t> data = {0xba,0xff,0xff,0xff,0xff,0x61,'a',0x01};
+        std::error_code ec;
+        json_decoder<json> decoder;
+        cbor::basic_cbor_reader<bytes_source> reader(data, decoder);
+        reader.read(ec);
+        CHECK(ec);
+        CHECK_FALSE(decoder.is_valid());
+    }
+}
+
+TEST_CASE("json_decoder presorted members tests")
+{
+    SECTION("sorted keys")
+    {
+        json j = json::parse(R"({"a":1,"b":2,"c":3})");
+        REQUIRE(j.size() == 3);
+        CHECK(j.object_range().begin()->key() == "a");
+        CHECK(j["c"].as<int>() == 3);
+    }
+
+    SECTION("unsorted keys")
+    {
+        json j = json::parse(R"({"c":3,"a":1,"b":2})");
+        REQUIRE(j.size() == 3);
+        CHECK(j.object_range().begin()->key() == "a");
+        CHECK(j.contains("b"));
+    }
+
+    SECTION("duplicate keys keep the first")
+    {
+        json j = json::parse(R"({"a":1,"b":2,"b":3,"c":4})");
+        REQUIRE(j.size() == 3);
+        CHECK(j["b"].as<int>() == 2);
+
+        ojson k = ojson::parse(R"({"a":1,"b":2,"b":3,"c":4})");
+        REQUIRE(k.size() == 3);
+        CHECK(k["b"].as<int>() == 2);
+    }
+
+    SECTION("ojson keeps input order")
+    {
+        ojson sorted = ojson::parse(R"({"a":1,"b":2,"c":3})");
+        CHECK(sorted.object_range().begin()->key() == "a");
+        CHECK(sorted["c"].as<int>() == 3);
+        CHECK(sorted.contains("b"));
+
+        ojson unsorted = ojson::parse(R"({"c":3,"a":1,"b":2})");
+        CHECK(unsorted.object_range().begin()->key() == "c");
+        CHECK(unsorted["a"].as<int>() == 1);
+        CHECK(unsorted.contains("b"));
+    }
+
+    SECTION("canonical cbor")
+    {
+        json expected = json::parse(R"({"a":[1,2,3],"b":{"x":true,"y":false},"c":"text"})");
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(expected, data);
+
+        json j = cbor::decode_cbor<json>(data);
+        CHECK(j == expected);
+        ojson k = cbor::decode_cbor<ojson>(data);
+        CHECK(k["b"]["y"].as<bool>() == false);
+    }
+}
+
+TEST_CASE("json object insert range tests")
+{
+    SECTION("insert after existing members")
+    {
+        json j = json::parse(R"({"b":1,"d":2})");
+        std::vector<std::pair<std::string,json>> more = {{"e",json(3)},{"f",json(4)}};
+        j.object_value().insert(more.begin(), more.end(),
+            [](const std::pair<std::string,json>& p){return json::key_value_type(p.first, p.second);});
+        CHECK(j == json::parse(R"({"b":1,"d":2,"e":3,"f":4})"));
+
+        std::vector<std::pair<std::string,json>> interleaved = {{"a",json(5)},{"c",json(6)}};
+        j.object_value().insert(interleaved.begin(), interleaved.end(),
+            [](const std::pair<std::string,json>& p){return json::key_value_type(p.first, p.second);});
+        CHECK(j == json::parse(R"({"a":5,"b":1,"c":6,"d":2,"e":3,"f":4})"));
+        CHECK(j.object_range().begin()->key() == "a");
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <unordered_set>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json hash tests")
+{
+    std::hash<json> hasher;
+
+    SECTION("equal values hash equal")
+    {
+        CHECK(hasher(json(1)) == hasher(json(1U)));
+        CHECK(hasher(json(1)) == hasher(json(1.0)));
+        CHECK(hasher(json(0.0)) == hasher(json(-0.0)));
+        CHECK(hasher(json(half_arg, 0x3c00)) == hasher(json(1.0)));
+        CHECK(hasher(json("Too long to fit in small string")) == hasher(json(std::string("Too long to fit in small string"))));
+        CHECK(hasher(json(json_object_arg)) == hasher(json::parse("{}")));
+        CHECK(hasher(json::null()) != hasher(json(false)));
+        CHECK(hasher(json(json_array_arg)) != hasher(json(json_object_arg)));
+        CHECK(hasher(json("1")) != hasher(json(1)));
+    }
+
+    SECTION("object hash does not depend on member order")
+    {
+        json j1 = json::parse(R"({"a":1,"b":[1,2,3],"c":{"d":true}})");
+        ojson j2 = ojson::parse(R"({"c":{"d":true},"b":[1,2,3],"a":1})");
+        ojson j3 = ojson::parse(R"({"a":1,"b":[1,2,3],"c":{"d":true}})");
+        CHECK(j1.hash() == j2.hash());
+        CHECK(j2.hash() == j3.hash());
+        CHECK(std::hash<ojson>()(j2) == j1.hash());
+
+        json j4 = json::parse(R"({"a":1,"b":[3,2,1],"c":{"d":true}})");
+        CHECK(j1.hash() != j4.hash());
+    }
+
+    SECTION("typed array hashes like array")
+    {
+        std::vector<double> v = {1.5, 2.5};
+        json a(typed_array_arg, jsoncons::span<const double>(v));
+        json b(json_array_arg, v.begin(), v.end());
+        CHECK(a.hash() == b.hash());
+    }
+
+    SECTION("unordered_set")
+    {
+        std::unordered_set<json> set;
+        set.insert(json::parse(R"({"a":1,"b":2})"));
+        set.insert(json::parse(R"({"b":2,"a":1})"));
+        set.insert(json::parse(R"([1,2])"));
+        CHECK(set.size() == 2);
+        CHECK(set.count(json::parse(R"([1.0,2])")) == 1);
+    }
+}
+
+TEST_CASE("json cached hash tests")
+{
+    SECTION("hash is cached until non-const access")
+    {
+        json j = json::parse(R"({"a":[1,2],"b":"x"})");
+        CHECK(j.cached_hash() == 0);
+        std::size_t h = j.hash();
+        CHECK(j.cached_hash() == h);
+        CHECK(j.at("a").cached_hash() != 0);
+
+        j["a"].push_back(3);
+        CHECK(j.cached_hash() == 0);
+        CHECK(j.hash() != h);
+        CHECK(j.hash() == json::parse(R"({"a":[1,2,3],"b":"x"})").hash());
+    }
+
+    SECTION("copy does not keep stale hash")
+    {
+        json j = json::parse(R"([1,2,3])");
+        j.hash();
+        json k(j);
+        CHECK(k.hash() == j.hash());
+        k.push_back(4);
+        CHECK(k.hash() != j.hash());
+    }
+
+    SECTION("equality short circuits on mismatch")
+    {
+        json j1 = json::parse(R"({"a":[1,2,3]})");
+        json j2 = json::parse(R"({"a":[1,2,4]})");
+        json j3 = json::parse(R"({"a":[1,2,3]})");
+        j1.hash();
+        j2.hash();
+        j3.hash();
+        CHECK_FALSE(j1 == j2);
+        CHECK(j1 != j2);
+        CHECK(j1 == j3);
+        CHECK(j1 < j2);
+        CHECK(j1.compare(j2) < 0);
+        CHECK(j2.compare(j1) > 0);
+    }
+}
@@ -0,0 +1,172 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace jsoncons;
+
+using interned_json = basic_json<char,interned_sorted_policy>;
+using interned_ojson = basic_json<char,interned_preserve_order_policy>;
+
+TEST_CASE("interned key tests")
+{
+    SECTION("same table shares buffer")
+    {
+        key_intern_table table;
+        auto k1 = table.intern("a longer member name");
+        auto k2 = table.intern(std::string("a longer member name"));
+        CHECK(k1.same_buffer(k2));
+        CHECK(k1.data() == k2.data());
+        CHECK(k1 == k2);
+        CHECK(table.size() == 1);
+
+        auto k3 = table.intern("other");
+        CHECK_FALSE(k1.same_buffer(k3));
+        CHECK(k1 < k3);
+        CHECK(table.size() == 2);
+    }
+
+    SECTION("keys outlive the table")
+    {
+        basic_interned_key<char> key;
+        {
+            key_intern_table table;
+            key = table.intern("name");
+        }
+        CHECK(key == string_view("name"));
+        CHECK(std::string(key.c_str()) == "name");
+    }
+
+    SECTION("keys not from a table compare by value")
+    {
+        basic_interned_key<char> k1("name");
+        basic_interned_key<char> k2(std::string("name"));
+        CHECK_FALSE(k1.same_buffer(k2));
+        CHECK(k1 == k2);
+        CHECK(k1.compare(k2) == 0);
+        CHECK(k1 != basic_interned_key<char>("other"));
+        CHECK(basic_interned_key<char>().empty());
+    }
+}
+
+TEST_CASE("interned_json tests")
+{
+    std::string input = R"(
+[
+    {"first_name" : "Jane", "last_name" : "Roe", "age" : 30},
+    {"first_name" : "John", "last_name" : "Doe", "age" : 40}
+]
+    )";
+
+    SECTION("parse shares keys within a document")
+    {
+        interned_json j = interned_json::parse(input);
+        REQUIRE(j.size() == 2);
+
+        auto it0 = j[0].object_range().begin();
+        auto it1 = j[1].object_range().begin();
+        CHECK(it0->key() == "age");
+        CHECK(it0->key().same_buffer(it1->key()));
+
+        CHECK(j[1]["first_name"].as<std::string>() == "John");
+        CHECK(j == interned_json::parse(input));
+        CHECK(j.to_string() == json::parse(input).to_string());
+    }
+
+    SECTION("shared table across documents")
+    {
+        key_intern_table table;
+
+        json_decoder<interned_json> decoder1;
+        decoder1.intern_keys(table);
+        json_reader reader1(input, decoder1);
+        reader1.read();
+        interned_json j1 = decoder1.get_result();
+
+        json_decoder<interned_json> decoder2;
+        decoder2.intern_keys(table);
+        json_reader reader2(input, decoder2);
+        reader2.read();
+        interned_json j2 = decoder2.get_result();
+
+        CHECK(table.size() == 3);
+        CHECK(j1[0].object_range().begin()->key().same_buffer(j2[1].object_range().begin()->key()));
+    }
+
+    SECTION("decoder table is kept across documents")
+    {
+        json_decoder<interned_ojson> decoder;
+        json_reader reader1(input, decoder);
+        reader1.read();
+        interned_ojson j1 = decoder.get_result();
+
+        json_reader reader2(input, decoder);
+        reader2.read();
+        interned_ojson j2 = decoder.get_result();
+
+        CHECK(j1[0].object_range().begin()->key() == "first_name");
+        CHECK(j1[0].object_range().begin()->key().same_buffer(j2[0].object_range().begin()->key()));
+    }
+
+    SECTION("modify")
+    {
+        interned_json j = interned_json::parse(input);
+        j[0]["city"] = "Toronto";
+        j[0].insert_or_assign("age", 31);
+        j[0].try_emplace("zip", "M5V");
+        j[0].erase("last_name");
+        CHECK(j[0].contains("city"));
+        CHECK_FALSE(j[0].contains("last_name"));
+        CHECK(j[0]["age"].as<int>() == 31);
+
+        interned_json copy(j);
+        CHECK(copy == j);
+    }
+
+    SECTION("conversions")
+    {
+        interned_json j = interned_json::parse(input);
+        auto m = j[0].as<std::map<std::string,interned_json>>();
+        CHECK(m.size() == 3);
+        CHECK(m["age"].as<int>() == 30);
+
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(j, data);
+        interned_json k = cbor::decode_cbor<interned_json>(data);
+        CHECK(k == j);
+    }
+
+    SECTION("concurrent decoding with a shared table")
+    {
+        key_intern_table table;
+        std::vector<interned_json> results(4);
+        std::vector<std::thread> threads;
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            threads.emplace_back([&table, &input, &results, i]()
+            {
+                json_decoder<interned_json> decoder;
+                decoder.intern_keys(table);
+                json_reader reader(input, decoder);
+                reader.read();
+                results[i] = decoder.get_result();
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        CHECK(table.size() == 3);
+        for (const auto& result : results)
+        {
+            CHECK(result == results[0]);
+            CHECK(result[1].object_range().begin()->key().same_buffer(results[0][0].object_range().begin()->key()));
+        }
+    }
+}
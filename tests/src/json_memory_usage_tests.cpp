@@ -0,0 +1,113 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json memory_usage tests")
+{
+    SECTION("scalars")
+    {
+        CHECK(json(10).memory_usage().total() == 0);
+        CHECK(json(null_type()).memory_usage().total() == 0);
+        CHECK(json("short").memory_usage().total() == 0);
+
+        std::string s(100, 'a');
+        json j(s);
+        json_memory_usage usage = j.memory_usage();
+        CHECK(usage.strings >= s.size());
+        CHECK(usage.total() == usage.strings);
+
+        std::vector<uint8_t> bytes(50, 1);
+        CHECK(json(byte_string_arg, bytes).memory_usage().strings >= bytes.size());
+    }
+
+    SECTION("array slack")
+    {
+        json j(json_array_arg);
+        j.reserve(100);
+        j.push_back(1);
+        j.push_back(2);
+        j.push_back(3);
+
+        json_memory_usage usage = j.memory_usage();
+        CHECK(usage.arrays >= 3*sizeof(json));
+        CHECK(usage.slack == 97*sizeof(json));
+
+        j.shrink_to_fit();
+        usage = j.memory_usage();
+        CHECK(usage.slack == 0);
+        CHECK(j == json::parse("[1,2,3]"));
+    }
+
+    SECTION("object keys and nested values")
+    {
+        std::string long_key(40, 'k');
+        std::string long_value(40, 'v');
+
+        json j(json_object_arg);
+        j.reserve(10);
+        j.try_emplace("a", 1);
+        j.try_emplace(long_key, long_value);
+        j.try_emplace("list", json(json_array_arg, {1,2,3}));
+
+        json_memory_usage usage = j.memory_usage();
+        CHECK(usage.objects >= 3*sizeof(json::key_value_type));
+        CHECK(usage.keys == long_key.size() + 1);
+        CHECK(usage.strings >= long_value.size());
+        CHECK(usage.arrays >= 3*sizeof(json));
+        CHECK(usage.slack >= 7*sizeof(json::key_value_type));
+
+        std::size_t before = usage.total();
+        j.shrink_to_fit();
+        json_memory_usage after = j.memory_usage();
+        CHECK(after.total() < before);
+        CHECK(after.slack == 0);
+        CHECK(after.keys == usage.keys);
+        CHECK(after.strings == usage.strings);
+    }
+
+    SECTION("ojson index")
+    {
+        ojson j = ojson::parse(R"({"b":1,"a":2,"c":3})");
+        json_memory_usage usage = j.memory_usage();
+        CHECK(usage.objects >= 3*sizeof(ojson::key_value_type) + 3*sizeof(std::size_t));
+    }
+
+    SECTION("typed array")
+    {
+        std::vector<double> v(64, 1.5);
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        CHECK(j.memory_usage().arrays >= v.size()*sizeof(double));
+    }
+
+    SECTION("interned keys are not counted")
+    {
+        using interned_json = basic_json<char,interned_sorted_policy>;
+        interned_json j = interned_json::parse(R"({"a member name that does not fit" : 1})");
+        CHECK(j.memory_usage().keys == 0);
+    }
+
+    SECTION("parsed document")
+    {
+        json j = json::parse(R"(
+[
+    {"title" : "A title that is long enough to allocate", "tags" : ["one","two","three"]},
+    {"title" : "Another title that is long enough to allocate", "tags" : []}
+]
+        )");
+        json_memory_usage usage = j.memory_usage();
+        CHECK(usage.strings > 0);
+        CHECK(usage.arrays > 0);
+        CHECK(usage.objects > 0);
+
+        json copy = j;
+        copy.shrink_to_fit();
+        CHECK(copy.memory_usage().total() <= usage.total());
+        CHECK(copy == j);
+    }
+}
@@ -0,0 +1,225 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_sequence_reader.hpp>
+#include <catch/catch.hpp>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    struct record
+    {
+        json value;
+        std::error_code ec;
+        uint64_t offset;
+        uint64_t length;
+    };
+
+    std::vector<record> read_records(const std::string& input, json_sequence_format format,
+                                     std::size_t buffer_length = 16384,
+                                     std::size_t max_record_length = (std::numeric_limits<std::size_t>::max)())
+    {
+        std::istringstream is(input);
+        json_sequence_reader reader(is, format);
+        reader.buffer_length(buffer_length);
+        reader.max_record_length(max_record_length);
+        std::vector<record> records;
+        while (true)
+        {
+            json_decoder<json> decoder;
+            std::error_code ec;
+            if (!reader.read_next(decoder, ec))
+            {
+                REQUIRE_FALSE(ec);
+                break;
+            }
+            records.push_back(record{decoder.is_valid() && !ec ? decoder.get_result() : json::null(), ec,
+                                     reader.record_offset(), reader.record_length()});
+        }
+        CHECK(reader.record_number() == records.size());
+        return records;
+    }
+
+} // namespace
+
+TEST_CASE("json_sequence_reader RFC 7464 tests")
+{
+    SECTION("valid records")
+    {
+        std::string input = "\x1e{\"a\":1}\n\x1e[1,2]\n\x1e\"text\"\n\x1e" "42\n";
+        for (std::size_t buffer_length : {1, 3, 16384})
+        {
+            auto records = read_records(input, json_sequence_format::text_sequence, buffer_length);
+            REQUIRE(records.size() == 4);
+            CHECK(records[0].value == json::parse(R"({"a":1})"));
+            CHECK(records[1].value == json::parse("[1,2]"));
+            CHECK(records[2].value == json("text"));
+            CHECK(records[3].value == json(42));
+            CHECK(records[0].offset == 1);
+            CHECK(records[0].length == 8);
+            CHECK(records[1].offset == 10);
+            CHECK(records[3].offset == 25);
+            for (const auto& r : records)
+            {
+                CHECK_FALSE(r.ec);
+            }
+        }
+    }
+
+    SECTION("resynchronize after a corrupt record")
+    {
+        std::string input = "\x1e{\"a\":1}\n\x1e{\"b\":[1,\n\x1e{\"c\":3}\n\x1enot json\n\x1e[]\n";
+        auto records = read_records(input, json_sequence_format::text_sequence);
+        REQUIRE(records.size() == 5);
+        CHECK_FALSE(records[0].ec);
+        CHECK(records[1].ec == json_errc::unexpected_eof);
+        CHECK(records[1].offset == 10);
+        CHECK_FALSE(records[2].ec);
+        CHECK(records[2].value == json::parse(R"({"c":3})"));
+        CHECK(records[3].ec);
+        CHECK_FALSE(records[4].ec);
+        CHECK(records[4].value == json::array());
+    }
+
+    SECTION("truncated scalar")
+    {
+        std::string input = "\x1e" "123\n\x1e" "123\x1e" "true";
+        auto records = read_records(input, json_sequence_format::text_sequence);
+        REQUIRE(records.size() == 3);
+        CHECK_FALSE(records[0].ec);
+        CHECK(records[1].ec == json_sequence_errc::truncated_record);
+        CHECK(records[2].ec == json_sequence_errc::truncated_record);
+    }
+
+    SECTION("text before the first separator and empty records")
+    {
+        std::string input = "garbage\x1e\x1e\n\x1e{}\n";
+        auto records = read_records(input, json_sequence_format::text_sequence);
+        REQUIRE(records.size() == 2);
+        CHECK(records[0].ec == json_sequence_errc::expected_record_separator);
+        CHECK(records[0].offset == 0);
+        CHECK(records[0].length == 7);
+        CHECK(records[1].value == json::object());
+    }
+
+    SECTION("two texts in one record")
+    {
+        std::string input = "\x1e{} {}\n";
+        auto records = read_records(input, json_sequence_format::text_sequence);
+        REQUIRE(records.size() == 1);
+        CHECK(records[0].ec == json_errc::extra_character);
+    }
+
+    SECTION("record too long")
+    {
+        std::string input = "\x1e[1,2,3,4,5,6,7,8,9]\n\x1e[1]\n";
+        auto records = read_records(input, json_sequence_format::text_sequence, 4, 10);
+        REQUIRE(records.size() == 2);
+        CHECK(records[0].ec == json_sequence_errc::record_too_long);
+        CHECK(records[0].length == 20);
+        CHECK(records[1].value == json::parse("[1]"));
+    }
+}
+
+TEST_CASE("json_sequence_reader json lines tests")
+{
+    std::string input = "{\"a\":1}\r\n\n{\"b\":\n[1,2]\n  \n\"x\"";
+    auto records = read_records(input, json_sequence_format::json_lines);
+    REQUIRE(records.size() == 4);
+    CHECK(records[0].value == json::parse(R"({"a":1})"));
+    CHECK(records[0].offset == 0);
+    CHECK(records[0].length == 8);
+    CHECK(records[1].ec == json_errc::unexpected_eof);
+    CHECK(records[1].offset == 10);
+    CHECK(records[2].value == json::parse("[1,2]"));
+    CHECK(records[3].value == json("x"));
+    CHECK(records[3].offset == 25);
+}
+
+TEST_CASE("json_sequence_reader concatenated tests")
+{
+    SECTION("valid texts")
+    {
+        std::string input = "{\"a\":\"}\"}[1,[2]]\"s\\\"\" 12 true\nnull{}";
+        for (std::size_t buffer_length : {1, 2, 5, 16384})
+        {
+            auto records = read_records(input, json_sequence_format::concatenated, buffer_length);
+            REQUIRE(records.size() == 7);
+            CHECK(records[0].value == json::parse(R"({"a":"}"})"));
+            CHECK(records[1].value == json::parse("[1,[2]]"));
+            CHECK(records[2].value == json("s\""));
+            CHECK(records[3].value == json(12));
+            CHECK(records[4].value == json(true));
+            CHECK(records[5].value == json::null());
+            CHECK(records[6].value == json::object());
+            CHECK(records[1].offset == 9);
+            CHECK(records[1].length == 7);
+            CHECK(records[6].offset == 34);
+        }
+    }
+
+    SECTION("corrupt texts")
+    {
+        std::string input = "{\"a\":1,}] [1] {\"b\" 2}";
+        auto records = read_records(input, json_sequence_format::concatenated);
+        REQUIRE(records.size() == 4);
+        CHECK(records[0].ec);
+        CHECK(records[1].ec);
+        CHECK(records[2].value == json::parse("[1]"));
+        CHECK(records[3].ec);
+    }
+}
+
+namespace {
+
+    struct reading
+    {
+        std::string sensor;
+        double value;
+    };
+
+} // namespace
+
+JSONCONS_ALL_MEMBER_TRAITS(reading, sensor, value)
+
+TEST_CASE("json_sequence_reader decode_next tests")
+{
+    std::string input = "\x1e{\"sensor\":\"a\",\"value\":1.5}\n\x1e{\"sensor\":\"b\"}\n\x1e{\"sensor\":\"c\",\"value\":2.5}\n\x1e{\"sensor\":\"d\n";
+    std::istringstream is(input);
+    json_sequence_reader reader(is);
+
+    std::vector<std::string> sensors;
+    std::vector<std::size_t> failed;
+    reading r;
+    std::error_code ec;
+    while (reader.decode_next(r, ec))
+    {
+        if (ec)
+        {
+            failed.push_back(reader.record_number());
+            ec = std::error_code();
+            continue;
+        }
+        sensors.push_back(r.sensor);
+    }
+    CHECK_FALSE(ec);
+    CHECK(sensors == std::vector<std::string>{"a", "c"});
+    CHECK(failed == std::vector<std::size_t>{2, 4});
+
+    SECTION("throwing overload")
+    {
+        std::istringstream is2("\x1e[1,2]\n\x1e[3\n");
+        json_sequence_reader reader2(is2);
+        std::vector<int> v;
+        CHECK(reader2.decode_next(v));
+        CHECK(v == std::vector<int>{1, 2});
+        CHECK_THROWS_AS(reader2.decode_next(v), ser_error);
+        CHECK_FALSE(reader2.decode_next(v));
+    }
+}
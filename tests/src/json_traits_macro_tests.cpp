@@ -458,6 +458,48 @@ namespace ns {
         jsoncons::optional<std::string> field12;
     };
 
+    struct point
+    {
+        double x;
+        double y;
+    };
+
+    class shape
+    {
+    public:
+        virtual ~shape() = default;
+        virtual double area() const = 0;
+    };
+
+    class circle : public shape
+    {
+    public:
+        point center;
+        double radius;
+
+        double area() const override
+        {
+            return 3.0*radius*radius;
+        }
+    };
+
+    class rectangle : public shape
+    {
+    public:
+        double width;
+        double height;
+
+        double area() const override
+        {
+            return width*height;
+        }
+    };
+
+    // Not declared, encoded as a rectangle
+    class square : public rectangle
+    {
+    };
+
 } // namespace ns
 } // namespace 
  
@@ -478,6 +520,11 @@ JSONCONS_ALL_CTOR_GETTER_TRAITS(ns::HourlyEmployee, firstName, lastName, wage, h
 JSONCONS_ALL_CTOR_GETTER_TRAITS(ns::CommissionedEmployee, firstName, lastName, baseSalary, commission, sales)
 JSONCONS_POLYMORPHIC_TRAITS(ns::Employee, ns::HourlyEmployee, ns::CommissionedEmployee)
 
+JSONCONS_ALL_MEMBER_TRAITS(ns::point, x, y)
+JSONCONS_ALL_MEMBER_TRAITS(ns::circle, center, radius)
+JSONCONS_ALL_MEMBER_TRAITS(ns::rectangle, width, height)
+JSONCONS_POLYMORPHIC_TAG_TRAITS(ns::shape, "kind", (ns::circle, "circle"), (ns::rectangle, "rectangle"))
+
 JSONCONS_ALL_GETTER_SETTER_TRAITS(ns::book3a, get, set, Author, Title, Price)
 JSONCONS_N_GETTER_SETTER_TRAITS(ns::book3b, get, set, 2, Author, Title, Price, Isbn)
 JSONCONS_N_GETTER_SETTER_TRAITS(ns::book3c, get, set, 2, Author, Title, Price, Isbn)
@@ -968,6 +1015,77 @@ TEST_CASE("JSONCONS_POLYMORPHIC_TRAITS tests")
     }
 }
 
+TEST_CASE("JSONCONS_POLYMORPHIC_TAG_TRAITS tests")
+{
+    std::string input = R"(
+[
+    {"kind": "circle", "center": {"x": 1.0, "y": 2.0}, "radius": 1.0},
+    {"width": 2.0, "kind": "rectangle", "height": 3.0},
+    {"kind": "triangle", "base": 2.0},
+    {"radius": 1.0},
+    null
+]
+    )"; 
+
+    SECTION("decode vector of shared_ptr")
+    {
+        auto v = jsoncons::decode_json<std::vector<std::shared_ptr<ns::shape>>>(input);
+        REQUIRE(v.size() == 5);
+        REQUIRE(dynamic_cast<ns::circle*>(v[0].get()) != nullptr);
+        CHECK(dynamic_cast<ns::circle*>(v[0].get())->center.y == 2.0);
+        CHECK(v[0]->area() == 3.0);
+        REQUIRE(dynamic_cast<ns::rectangle*>(v[1].get()) != nullptr);
+        CHECK(v[1]->area() == 6.0);
+        CHECK(v[2].get() == nullptr);
+        CHECK(v[3].get() == nullptr);
+        CHECK(v[4].get() == nullptr);
+    }
+
+    SECTION("decode vector of unique_ptr from a json")
+    {
+        json j = json::parse(input);
+        CHECK(j[0].is<std::unique_ptr<ns::shape>>());
+        CHECK(j[1].is<std::unique_ptr<ns::shape>>());
+        CHECK_FALSE(j[2].is<std::unique_ptr<ns::shape>>());
+        CHECK_FALSE(j[3].is<std::unique_ptr<ns::shape>>());
+
+        auto v = j.as<std::vector<std::unique_ptr<ns::shape>>>();
+        REQUIRE(v.size() == 5);
+        CHECK(v[0]->area() == 3.0);
+        CHECK(v[1]->area() == 6.0);
+        CHECK(v[2].get() == nullptr);
+    }
+
+    SECTION("encode vector of shared_ptr")
+    {
+        std::vector<std::shared_ptr<ns::shape>> v;
+        auto c = std::make_shared<ns::circle>();
+        c->center = ns::point{1.0, 2.0};
+        c->radius = 1.0;
+        v.push_back(c);
+        auto s = std::make_shared<ns::square>();
+        s->width = 2.0;
+        s->height = 2.0;
+        v.push_back(s);
+        v.push_back(std::shared_ptr<ns::shape>());
+
+        std::string output;
+        encode_json(v, output);
+        CHECK(output == R"([{"kind":"circle","center":{"x":1.0,"y":2.0},"radius":1.0},{"kind":"rectangle","width":2.0,"height":2.0},null])");
+
+        json j(v);
+        CHECK(j[0]["kind"].as<std::string>() == "circle");
+        CHECK(j[1]["kind"].as<std::string>() == "rectangle");
+        CHECK(j[2].is_null());
+
+        auto v2 = decode_json<std::vector<std::unique_ptr<ns::shape>>>(output);
+        REQUIRE(v2.size() == 3);
+        CHECK(v2[0]->area() == 3.0);
+        CHECK(v2[1]->area() == 4.0);
+        CHECK(v2[2].get() == nullptr);
+    }
+}
+
 TEST_CASE("JSONCONS_N_GETTER_SETTER_TRAITS tests")
 {
     std::string an_author = "Haruki Murakami"; 
@@ -0,0 +1,206 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <catch/catch.hpp>
+#include <array>
+#include <sstream>
+#include <vector>
+
+using namespace jsoncons;
+
+TEST_CASE("json typed array storage tests")
+{
+    std::vector<double> v = {1.5, 2.5, 3.5, 4.5};
+
+    SECTION("construct from span")
+    {
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        CHECK(j.storage() == storage_kind::typed_array_value);
+        CHECK(j.is_array());
+        CHECK(j.is_typed_array());
+        CHECK(j.typed_element_type() == typed_array_type::double_value);
+        CHECK(j.size() == 4);
+        CHECK_FALSE(j.empty());
+
+        auto s = j.as_span<double>();
+        REQUIRE(s.size() == 4);
+        CHECK(s[0] == 1.5);
+        CHECK(s[3] == 4.5);
+        CHECK(s.data() != v.data());
+
+        CHECK(j.typed_element(1) == json(2.5));
+        REQUIRE_THROWS(j.as_span<float>());
+    }
+
+    SECTION("as vector")
+    {
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        CHECK(j.is<std::vector<double>>());
+        CHECK(j.as<std::vector<double>>() == v);
+
+        auto w = j.as<std::vector<int>>();
+        CHECK(w == std::vector<int>({1,2,3,4}));
+
+        auto a = j.as<std::array<double,4>>();
+        CHECK(a[2] == 3.5);
+    }
+
+    SECTION("integer elements")
+    {
+        std::vector<uint16_t> u = {1, 2, 65535};
+        json j(typed_array_arg, jsoncons::span<const uint16_t>(u));
+        CHECK(j.typed_element_type() == typed_array_type::uint16_value);
+        CHECK(j.typed_element(2).as<uint64_t>() == 65535);
+        CHECK(j.as<std::vector<uint16_t>>() == u);
+
+        std::vector<int8_t> i = {-1, 0, 1};
+        json k(typed_array_arg, jsoncons::span<const int8_t>(i));
+        CHECK(k.typed_element(0).as<int>() == -1);
+        CHECK(k.as<std::vector<int8_t>>() == i);
+    }
+
+    SECTION("compare")
+    {
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        json a(json_array_arg, v.begin(), v.end());
+        CHECK(j == a);
+        CHECK(a == j);
+        CHECK(j == json(typed_array_arg, jsoncons::span<const double>(v)));
+
+        std::vector<double> other = {1.5, 2.5};
+        json k(typed_array_arg, jsoncons::span<const double>(other));
+        CHECK(k < j);
+        CHECK(j != k);
+    }
+
+    SECTION("copy and swap")
+    {
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        json k(j);
+        CHECK(k.storage() == storage_kind::typed_array_value);
+        CHECK(k.as_span<double>().data() != j.as_span<double>().data());
+        CHECK(k == j);
+
+        json other(10);
+        other.swap(k);
+        CHECK(other.is_typed_array());
+        CHECK(k.as<int>() == 10);
+
+        json m(std::move(other));
+        CHECK(m.is_typed_array());
+        CHECK(m.size() == 4);
+    }
+
+    SECTION("dump")
+    {
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        std::string s;
+        j.dump(s);
+        CHECK(s == "[1.5,2.5,3.5,4.5]");
+    }
+
+    SECTION("unpack")
+    {
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        j.push_back(5.5);
+        CHECK(j.storage() == storage_kind::array_value);
+        CHECK(j.size() == 5);
+        CHECK(j[4] == json(5.5));
+        CHECK(j[0] == json(1.5));
+
+        json k(typed_array_arg, jsoncons::span<const double>(v));
+        k.unpack();
+        CHECK(k.storage() == storage_kind::array_value);
+        CHECK(k.size() == 4);
+
+        const json c(typed_array_arg, jsoncons::span<const double>(v));
+        REQUIRE_THROWS(c.at(0));
+        REQUIRE_THROWS(c.array_range());
+    }
+
+    SECTION("modify elements through span")
+    {
+        json j(typed_array_arg, jsoncons::span<const double>(v));
+        j.as_span<double>()[0] = 10.0;
+        CHECK(j.typed_element(0) == json(10.0));
+    }
+}
+
+TEST_CASE("json parse with pack_numeric_arrays")
+{
+    std::string input = R"(
+{
+    "doubles" : [1.5, 2.5, 3.5],
+    "ints" : [-1, 2, -3],
+    "uints" : [1, 2, 3],
+    "mixed" : [1, 2.5, "three"],
+    "too_big" : [-1, 18446744073709551615],
+    "empty" : []
+}
+    )";
+
+    auto options = json_options{}.pack_numeric_arrays(true);
+
+    SECTION("json::parse")
+    {
+        json j = json::parse(input, options);
+        CHECK(j["doubles"].storage() == storage_kind::typed_array_value);
+        CHECK(j["doubles"].typed_element_type() == typed_array_type::double_value);
+        CHECK(j["ints"].storage() == storage_kind::typed_array_value);
+        CHECK(j["ints"].typed_element_type() == typed_array_type::int64_value);
+        CHECK(j["uints"].typed_element_type() == typed_array_type::uint64_value);
+        CHECK(j["mixed"].storage() == storage_kind::array_value);
+        CHECK(j["too_big"].storage() == storage_kind::array_value);
+        CHECK(j["empty"].storage() == storage_kind::array_value);
+
+        CHECK(j == json::parse(input));
+        CHECK(j["doubles"].as<std::vector<double>>() == std::vector<double>({1.5, 2.5, 3.5}));
+    }
+
+    SECTION("decode_json")
+    {
+        json j = decode_json<json>(input, options);
+        CHECK(j["doubles"].storage() == storage_kind::typed_array_value);
+    }
+
+    SECTION("default is not to pack")
+    {
+        json j = json::parse(input);
+        CHECK(j["doubles"].storage() == storage_kind::array_value);
+    }
+
+    SECTION("root array")
+    {
+        json j = json::parse("[1.5,2.5]", options);
+        CHECK(j.storage() == storage_kind::typed_array_value);
+    }
+}
+
+TEST_CASE("cbor typed array to packed json")
+{
+    std::vector<float> v = {1.0f, 2.0f, 3.5f};
+
+    std::vector<uint8_t> data;
+    cbor::encode_cbor(v, data, cbor::cbor_options{}.use_typed_arrays(true));
+
+    SECTION("packed")
+    {
+        json j = cbor::decode_cbor<json>(data, cbor::cbor_options{}.pack_numeric_arrays(true));
+        CHECK(j.storage() == storage_kind::typed_array_value);
+        CHECK(j.typed_element_type() == typed_array_type::float_value);
+        CHECK(j.as<std::vector<float>>() == v);
+
+        std::vector<uint8_t> out;
+        cbor::encode_cbor(j, out, cbor::cbor_options{}.use_typed_arrays(true));
+        CHECK(out == data);
+    }
+
+    SECTION("not packed")
+    {
+        json j = cbor::decode_cbor<json>(data);
+        CHECK(j.storage() == storage_kind::array_value);
+        CHECK(j.as<std::vector<float>>() == v);
+    }
+}
@@ -0,0 +1,169 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/persistent_json.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+using pjson = persistent_json<json>;
+
+TEST_CASE("persistent_json conversion tests")
+{
+    json j = json::parse(R"(
+{
+    "name" : "config",
+    "version" : 3,
+    "servers" : [
+        {"host" : "a.example.com", "port" : 8080},
+        {"host" : "b.example.com", "port" : 8081}
+    ],
+    "empty" : {},
+    "ratio" : 0.5
+}
+    )");
+
+    SECTION("round trip")
+    {
+        pjson p(j);
+        CHECK(p.is_object());
+        CHECK(p.size() == 5);
+        CHECK(p.at("name").as<std::string>() == "config");
+        CHECK(p["servers"].is_array());
+        CHECK(p["servers"][1]["port"].as<int>() == 8081);
+        CHECK(p.to_json() == j);
+    }
+
+    SECTION("missing members")
+    {
+        pjson p(j);
+        CHECK_FALSE(p.contains("missing"));
+        CHECK(p.find("missing") == nullptr);
+        REQUIRE_THROWS_AS(p.at("missing"), key_not_found);
+        REQUIRE_THROWS(p["servers"].at(5));
+        REQUIRE_THROWS(p.at(0));
+    }
+}
+
+TEST_CASE("persistent_json modification tests")
+{
+    json j = json::parse(R"({"a" : {"b" : [1,2,3]}, "c" : "unchanged"})");
+    pjson v1(j);
+
+    SECTION("with member returns new version")
+    {
+        pjson v2 = v1.with("d", pjson(json(true)));
+        CHECK(v2.size() == 3);
+        CHECK(v1.size() == 2);
+        CHECK_FALSE(v1.contains("d"));
+        CHECK(v2["d"].as<bool>());
+
+        // Untouched subtree is shared
+        CHECK(v2["a"].shares_root_with(v1["a"]));
+        CHECK(v2["a"] == v1["a"]);
+    }
+
+    SECTION("nested update")
+    {
+        pjson b = v1["a"]["b"].with(1, pjson(json(20)));
+        pjson v2 = v1.with("a", v1["a"].with("b", b));
+
+        CHECK(v1.to_json() == j);
+        CHECK(v2.to_json() == json::parse(R"({"a" : {"b" : [1,20,3]}, "c" : "unchanged"})"));
+        CHECK(v2 != v1);
+    }
+
+    SECTION("replace and remove")
+    {
+        pjson v2 = v1.with("c", pjson(json("changed")));
+        CHECK(v2.size() == 2);
+        CHECK(v2["c"].as<std::string>() == "changed");
+        CHECK(v1["c"].as<std::string>() == "unchanged");
+
+        pjson v3 = v2.without("c");
+        CHECK(v3.size() == 1);
+        CHECK_FALSE(v3.contains("c"));
+        CHECK(v2.contains("c"));
+
+        pjson v4 = v3.without("not there");
+        CHECK(v4.shares_root_with(v3));
+
+        pjson v5 = v3.without("a");
+        CHECK(v5.empty());
+        CHECK(v5.to_json() == json(json_object_arg));
+    }
+
+    SECTION("copy is a snapshot")
+    {
+        pjson snapshot = v1;
+        CHECK(snapshot.shares_root_with(v1));
+        v1 = v1.with("c", pjson(json(1)));
+        CHECK(snapshot["c"].as<std::string>() == "unchanged");
+    }
+}
+
+TEST_CASE("persistent_json large containers")
+{
+    SECTION("array")
+    {
+        const std::size_t n = 5000;
+        pjson a = pjson::make_array();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            a = a.push_back(pjson(json(i)));
+        }
+        REQUIRE(a.size() == n);
+        for (std::size_t i = 0; i < n; i += 97)
+        {
+            CHECK(a[i].as<std::size_t>() == i);
+        }
+        CHECK(a[n-1].as<std::size_t>() == n-1);
+
+        pjson b = a.with(1234, pjson(json("x")));
+        CHECK(b[1234].as<std::string>() == "x");
+        CHECK(a[1234].as<std::size_t>() == 1234);
+
+        json j = b.to_json();
+        CHECK(j.size() == n);
+        CHECK(j[1234] == json("x"));
+        CHECK(pjson(j) == b);
+    }
+
+    SECTION("object")
+    {
+        const std::size_t n = 3000;
+        pjson o = pjson::make_object();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            o = o.with(std::to_string(i), pjson(json(i)));
+        }
+        REQUIRE(o.size() == n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            REQUIRE(o.contains(std::to_string(i)));
+            CHECK(o[std::to_string(i)].as<std::size_t>() == i);
+        }
+        std::size_t count = 0;
+        o.for_each_member([&](const string_view&, const pjson&){++count;});
+        CHECK(count == n);
+
+        pjson p = o;
+        for (std::size_t i = 0; i < n; i += 2)
+        {
+            p = p.without(std::to_string(i));
+        }
+        CHECK(p.size() == n/2);
+        CHECK(o.size() == n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            CHECK(p.contains(std::to_string(i)) == (i % 2 == 1));
+        }
+
+        json j = o.to_json();
+        CHECK(j.size() == n);
+        CHECK(pjson(j) == o);
+    }
+}
@@ -0,0 +1,167 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#if defined(_MSC_VER)
+#include "windows.h" // test no inadvertant macro expansions
+#endif
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/pipelined_staj_iterator.hpp>
+#include <jsoncons_ext/cbor/cbor.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <catch/catch.hpp>
+
+using namespace jsoncons;
+
+namespace pipelined_staj_iterator_tests {
+
+    struct record
+    {
+        int id;
+        std::string name;
+        std::vector<double> values;
+    };
+
+} // namespace pipelined_staj_iterator_tests
+
+JSONCONS_ALL_MEMBER_TRAITS(pipelined_staj_iterator_tests::record, id, name, values)
+
+namespace {
+
+    std::string make_records(std::size_t n)
+    {
+        json a(json_array_arg);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            json rec;
+            rec["id"] = i;
+            rec["name"] = "record " + std::to_string(i);
+            rec["values"] = json(json_array_arg, {0.5*static_cast<double>(i), 1.5});
+            a.push_back(std::move(rec));
+        }
+        return a.to_string();
+    }
+
+} // namespace
+
+TEST_CASE("pipelined_staj_array_view tests")
+{
+    using pipelined_staj_iterator_tests::record;
+
+    SECTION("elements are delivered in order")
+    {
+        std::string s = make_records(1000);
+        json_cursor cursor(s);
+
+        auto view = pipelined_staj_array<record>(cursor, 4, 8);
+        CHECK(view.worker_count() == 4);
+        CHECK(view.capacity() == 8);
+        std::size_t count = 0;
+        for (const auto& rec : view)
+        {
+            CHECK(rec.id == static_cast<int>(count));
+            CHECK(rec.name == "record " + std::to_string(count));
+            REQUIRE(rec.values.size() == 2);
+            ++count;
+        }
+        CHECK(count == 1000);
+        CHECK(cursor.current().event_type() == staj_event_type::end_array);
+    }
+
+    SECTION("json elements from a stream")
+    {
+        std::string s = make_records(50);
+        std::istringstream is(s);
+        json_cursor cursor(is);
+
+        std::vector<json> expected = json::parse(s).as<std::vector<json>>();
+        std::vector<json> result;
+        for (const auto& j : pipelined_staj_array<json>(cursor, 3))
+        {
+            result.push_back(j);
+        }
+        CHECK(result == expected);
+    }
+
+    SECTION("scalar elements")
+    {
+        std::string s = R"([1, "two", 3.5, null, [4], {"five" : 5}])";
+        json_cursor cursor(s);
+        std::vector<json> result;
+        for (const auto& j : pipelined_staj_array<json>(cursor, 2, 2))
+        {
+            result.push_back(j);
+        }
+        CHECK(json(json_array_arg, result.begin(), result.end()) == json::parse(s));
+    }
+
+    SECTION("empty array and not an array")
+    {
+        json_cursor cursor1(std::string("[]"));
+        auto view1 = pipelined_staj_array<json>(cursor1);
+        CHECK(bool(view1.begin() == view1.end()));
+
+        json_cursor cursor2(std::string("{}"));
+        auto view2 = pipelined_staj_array<json>(cursor2);
+        CHECK(bool(view2.begin() == view2.end()));
+    }
+
+    SECTION("conversion error in one element")
+    {
+        std::string s = R"([{"id":1,"name":"a","values":[]},{"id":"x","name":"b","values":[]},{"id":3,"name":"c","values":[]}])";
+        json_cursor cursor(s);
+        auto view = pipelined_staj_array<record>(cursor, 2);
+        auto it = view.begin();
+        CHECK(it->id == 1);
+        ++it;
+        CHECK_FALSE(it.has_value());
+        CHECK_THROWS(*it);
+        ++it;
+        CHECK(it->id == 3);
+        ++it;
+        CHECK(bool(it == view.end()));
+    }
+
+    SECTION("parse error")
+    {
+        std::string s = R"([{"id":1,"name":"a","values":[]},{"id":2,"name":"b","values":[})";
+        json_cursor cursor(s);
+        auto view = pipelined_staj_array<record>(cursor, 2);
+        std::error_code ec;
+        auto it = view.begin();
+        CHECK(it->id == 1);
+        it.increment(ec);
+        CHECK(ec);
+        CHECK(bool(it == view.end()));
+    }
+
+    SECTION("stop early")
+    {
+        std::string s = make_records(500);
+        json_cursor cursor(s);
+        {
+            auto view = pipelined_staj_array<record>(cursor, 2, 4);
+            auto it = view.begin();
+            CHECK(it->id == 0);
+            ++it;
+            CHECK(it->id == 1);
+        }
+    }
+
+    SECTION("cbor cursor")
+    {
+        std::string s = make_records(100);
+        std::vector<uint8_t> data;
+        cbor::encode_cbor(json::parse(s), data);
+        cbor::cbor_bytes_cursor cursor(data);
+        int expected = 0;
+        for (const auto& rec : pipelined_staj_array<record>(cursor))
+        {
+            CHECK(rec.id == expected);
+            ++expected;
+        }
+        CHECK(expected == 100);
+    }
+}
@@ -0,0 +1,211 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/record_index.hpp>
+#include <catch/catch.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    std::string record_text(const std::string& data, const record_index& index, std::size_t i)
+    {
+        return data.substr(static_cast<std::size_t>(index[i].offset), static_cast<std::size_t>(index[i].length));
+    }
+
+} // namespace
+
+TEST_CASE("record_index json_lines tests")
+{
+    std::string data = "{\"id\":3,\"name\":\"c\"}\n"
+                       "\n"
+                       "{\"id\":1,\"name\":\"a \\\"}\\\" b\",\"tags\":[1,2]}\r\n"
+                       "  [\"x\"]\n"
+                       "\"text\" 42 true\n"
+                       "{\"id\":2}";
+
+    SECTION("offsets and lengths")
+    {
+        std::istringstream is(data);
+        record_index index = build_record_index(is, record_format::json_lines);
+        REQUIRE(index.size() == 7);
+        CHECK_FALSE(index.has_keys());
+        CHECK(record_text(data, index, 0) == "{\"id\":3,\"name\":\"c\"}");
+        CHECK(record_text(data, index, 1) == "{\"id\":1,\"name\":\"a \\\"}\\\" b\",\"tags\":[1,2]}");
+        CHECK(record_text(data, index, 2) == "[\"x\"]");
+        CHECK(record_text(data, index, 3) == "\"text\"");
+        CHECK(record_text(data, index, 4) == "42");
+        CHECK(record_text(data, index, 5) == "true");
+        CHECK(record_text(data, index, 6) == "{\"id\":2}");
+        for (std::size_t i = 0; i < index.size(); ++i)
+        {
+            CHECK_NOTHROW(json::parse(record_text(data, index, i)));
+        }
+    }
+
+    SECTION("keys")
+    {
+        std::istringstream is(data);
+        record_index index = build_record_index(is, record_format::json_lines, "/id");
+        REQUIRE(index.size() == 7);
+        REQUIRE(index.has_keys());
+        CHECK(index.key(0) == json(3));
+        CHECK(index.key(1) == json(1));
+        CHECK(index.key(2).is_null());
+        CHECK(index.key(6) == json(2));
+
+        CHECK(index.find(json(1)) == 1);
+        CHECK(index.find(json(2)) == 6);
+        CHECK(index.find(json(5)) == record_index::npos);
+
+        // The nulls sort first
+        CHECK(index.lower_bound(json(1)) == 4);
+        CHECK(index.upper_bound(json(3)) == 7);
+        CHECK(index.key_order(4) == 1);
+        CHECK(index.key_order(5) == 6);
+        CHECK(index.key_order(6) == 0);
+    }
+
+    SECTION("nested key path")
+    {
+        std::istringstream is(data);
+        record_index index = build_record_index(is, record_format::json_lines, "/tags/1");
+        CHECK(index.key(1) == json(2));
+        CHECK(index.key(0).is_null());
+    }
+
+    SECTION("invalid key path")
+    {
+        std::istringstream is(data);
+        std::error_code ec;
+        build_record_index(is, record_format::json_lines, "id", ec);
+        CHECK(ec == record_index_errc::invalid_key_path);
+    }
+
+    SECTION("unterminated record")
+    {
+        std::istringstream is("{\"a\":1}\n{\"a\":[1,2}");
+        std::error_code ec;
+        build_record_index(is, record_format::json_lines, "", ec);
+        CHECK(ec == record_index_errc::unexpected_eof);
+    }
+}
+
+TEST_CASE("record_index json_array tests")
+{
+    std::string data = "\xef\xbb\xbf [ {\"k\":\"b\", \"v\":[1,{\"a\":\"]\"}]} ,\n -1.5e3,\"s,]\" ,{\"k\":\"a\"}, [] ]  ";
+
+    SECTION("offsets and keys")
+    {
+        std::istringstream is(data);
+        record_index index = build_record_index(is, record_format::json_array, "/k");
+        REQUIRE(index.size() == 5);
+        CHECK(record_text(data, index, 0) == "{\"k\":\"b\", \"v\":[1,{\"a\":\"]\"}]}");
+        CHECK(record_text(data, index, 1) == "-1.5e3");
+        CHECK(record_text(data, index, 2) == "\"s,]\"");
+        CHECK(record_text(data, index, 3) == "{\"k\":\"a\"}");
+        CHECK(record_text(data, index, 4) == "[]");
+        CHECK(index.find(json("a")) == 3);
+        CHECK(index.find(json("b")) == 0);
+    }
+
+    SECTION("not an array")
+    {
+        std::istringstream is("{\"a\":1}");
+        std::error_code ec;
+        build_record_index(is, record_format::json_array, "", ec);
+        CHECK(ec == record_index_errc::expected_array);
+    }
+
+    SECTION("unterminated array")
+    {
+        std::istringstream is("[1,2");
+        std::error_code ec;
+        build_record_index(is, record_format::json_array, "", ec);
+        CHECK(ec == record_index_errc::unexpected_eof);
+    }
+
+    SECTION("large input")
+    {
+        std::string big = "[";
+        for (int i = 0; i < 5000; ++i)
+        {
+            if (i > 0)
+            {
+                big.push_back(',');
+            }
+            big.append("{\"id\":" + std::to_string(4999-i) + ",\"text\":\"" + std::string(static_cast<std::size_t>(i % 17), 'x') + "\"}");
+        }
+        big.push_back(']');
+        std::istringstream is(big);
+        record_index index = build_record_index(is, record_format::json_array, "/id");
+        REQUIRE(index.size() == 5000);
+        json j = json::parse(record_text(big, index, 1234));
+        CHECK(j["id"].as<int>() == 4999-1234);
+        CHECK(index.find(json(0)) == 4999);
+    }
+}
+
+TEST_CASE("record_index partition tests")
+{
+    record_index index;
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        index.push_back(i*100, 100);
+    }
+    std::vector<std::size_t> parts = index.partition(3);
+    REQUIRE(parts.size() == 4);
+    CHECK(parts[0] == 0);
+    CHECK(parts[1] == 3);
+    CHECK(parts[2] == 7);
+    CHECK(parts[3] == 10);
+
+    parts = index.partition(20);
+    REQUIRE(parts.size() == 21);
+    CHECK(parts.back() == 10);
+    for (std::size_t k = 1; k < parts.size(); ++k)
+    {
+        CHECK(parts[k-1] <= parts[k]);
+    }
+}
+
+TEST_CASE("record_index write and read tests")
+{
+    std::string data = "{\"k\":\"x\"}\n{\"k\":-7}\n{\"k\":2.5}\n{\"k\":true}\n{\"k\":[1,2]}\n{}\n{\"k\":18446744073709551615}";
+    std::istringstream is(data);
+    record_index index = build_record_index(is, record_format::json_lines, "/k");
+
+    std::stringstream ss;
+    index.write(ss);
+
+    record_index index2 = record_index::read(ss);
+    CHECK(index2.format() == record_format::json_lines);
+    CHECK(index2.key_path() == "/k");
+    REQUIRE(index2.size() == index.size());
+    for (std::size_t i = 0; i < index.size(); ++i)
+    {
+        CHECK(index2[i].offset == index[i].offset);
+        CHECK(index2[i].length == index[i].length);
+        CHECK(index2.key(i) == index.key(i));
+        CHECK(index2.key_order(i) == index.key_order(i));
+    }
+    CHECK(index2.find(json("x")) == 0);
+
+    SECTION("invalid file")
+    {
+        std::string s = ss.str();
+        s.resize(s.size()/2);
+        std::istringstream is2(s);
+        std::error_code ec;
+        record_index::read(is2, ec);
+        CHECK(ec == record_index_errc::invalid_index_file);
+
+        std::istringstream is3("JSON");
+        record_index::read(is3, ec);
+        CHECK(ec == record_index_errc::invalid_index_file);
+    }
+}
@@ -0,0 +1,238 @@
+// Copyright 2021 Daniel Parker
+// Distributed under Boost license
+
+#include <jsoncons/json.hpp>
+#include <jsoncons/json_cursor.hpp>
+#include <jsoncons/staj_adaptors.hpp>
+#include <catch/catch.hpp>
+#include <string>
+#include <vector>
+
+using namespace jsoncons;
+
+namespace {
+
+    template <class View>
+    json read_view(View& view)
+    {
+        json_decoder<json> decoder;
+        view.read_to(decoder);
+        return decoder.get_result();
+    }
+
+    template <class View>
+    std::vector<staj_event_type> read_event_types(View& view)
+    {
+        std::vector<staj_event_type> types;
+        for (; !view.done(); view.next())
+        {
+            types.push_back(view.current().event_type());
+        }
+        return types;
+    }
+
+    struct is_value_event
+    {
+        bool operator()(const staj_event& event, const ser_context&) const
+        {
+            return event.event_type() != staj_event_type::key;
+        }
+    };
+
+} // namespace
+
+TEST_CASE("staj adaptors project tests")
+{
+    std::string input = R"(
+[
+    {"id": 1, "name": "a", "tags": ["x","y"], "address": {"city": "Toronto", "zip": "M5V"}},
+    {"id": 2, "name": "b", "tags": [], "address": {"city": "Montreal", "zip": "H2X"}}
+]
+    )";
+
+    SECTION("member of each element")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({"/*/id", "/*/address/city"});
+        json expected = json::parse(R"([{"id":1,"address":{"city":"Toronto"}},{"id":2,"address":{"city":"Montreal"}}])");
+        CHECK(read_view(view) == expected);
+    }
+
+    SECTION("element by index")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({"/1/tags", "/0/name"});
+        json expected = json::parse(R"([{"name":"a"},{"tags":[]}])");
+        CHECK(read_view(view) == expected);
+    }
+
+    SECTION("whole document")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({""});
+        CHECK(read_view(view) == json::parse(input));
+    }
+
+    SECTION("no match")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({"/*/missing"});
+        CHECK(read_view(view) == json::parse("[{},{}]"));
+    }
+
+    SECTION("escaped key")
+    {
+        json_cursor cursor(R"({"a/b": 1, "c~d": 2, "e": 3})");
+        auto view = cursor | staj::project({"/a~1b", "/c~0d"});
+        CHECK(read_view(view) == json::parse(R"({"a/b":1,"c~d":2})"));
+    }
+
+    SECTION("invalid pointer")
+    {
+        CHECK_THROWS(staj::project({"a"}));
+        CHECK_THROWS(staj::project({"/a~2"}));
+    }
+
+    SECTION("wide characters")
+    {
+        wjson_cursor cursor(LR"({"a": {"b": 1, "c": 2}, "d": 3})");
+        auto view = cursor | staj::project({L"/a/c"});
+        json_decoder<wjson> decoder;
+        view.read_to(decoder);
+        CHECK(decoder.get_result() == wjson::parse(LR"({"a":{"c":2}})"));
+    }
+}
+
+TEST_CASE("staj adaptors max_depth tests")
+{
+    std::string input = R"({"a": 1, "b": {"c": [1, 2], "d": 3}, "e": [4, {"f": 5}]})";
+
+    SECTION("depth 1")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::max_depth(1);
+        CHECK(read_view(view) == json::parse(R"({"a":1,"b":{},"e":[]})"));
+    }
+
+    SECTION("depth 2")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::max_depth(2);
+        CHECK(read_view(view) == json::parse(R"({"a":1,"b":{"c":[],"d":3},"e":[4,{}]})"));
+    }
+
+    SECTION("skip a container")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::max_depth(1);
+        view.next(); // "a"
+        view.next(); // 1
+        view.next(); // "b"
+        view.skip();
+        REQUIRE_FALSE(view.done());
+        CHECK(view.current().event_type() == staj_event_type::key);
+        CHECK(view.current().get<std::string>() == "e");
+    }
+}
+
+TEST_CASE("staj adaptors take tests")
+{
+    std::string input = R"([1, 2, 3, 4, 5])";
+
+    SECTION("fewer than available")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::take(3);
+        std::vector<staj_event_type> expected = {staj_event_type::begin_array, staj_event_type::uint64_value, staj_event_type::uint64_value};
+        CHECK(read_event_types(view) == expected);
+        CHECK_FALSE(cursor.done());
+    }
+
+    SECTION("more than available")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::take(100);
+        CHECK(read_event_types(view).size() == 7);
+    }
+
+    SECTION("none")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::take(0);
+        CHECK(view.done());
+    }
+}
+
+TEST_CASE("staj adaptors composition tests")
+{
+    std::string input = R"(
+[
+    {"id": 1, "name": "a", "address": {"city": "Toronto"}},
+    {"id": 2, "name": "b", "address": {"city": "Montreal"}},
+    {"id": 3, "name": "c", "address": {"city": "Vancouver"}}
+]
+    )";
+
+    SECTION("project, filter and take")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({"/*/name"})
+                           | staj::filter([](const staj_event& event, const ser_context&) {return event.event_type() == staj_event_type::string_value;})
+                           | staj::take(2);
+        std::vector<std::string> names;
+        for (; !view.done(); view.next())
+        {
+            names.push_back(view.current().get<std::string>());
+        }
+        CHECK(names == std::vector<std::string>{"a", "b"});
+    }
+
+    SECTION("filter with a function object")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({"/*/id"}) | staj::filter(is_value_event());
+        std::vector<staj_event_type> expected = {staj_event_type::begin_array,
+            staj_event_type::begin_object, staj_event_type::uint64_value, staj_event_type::end_object,
+            staj_event_type::begin_object, staj_event_type::uint64_value, staj_event_type::end_object,
+            staj_event_type::begin_object, staj_event_type::uint64_value, staj_event_type::end_object,
+            staj_event_type::end_array};
+        CHECK(read_event_types(view) == expected);
+    }
+
+    SECTION("max_depth after project")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({"/*/address", "/*/id"}) | staj::max_depth(1);
+        CHECK(read_view(view) == json::parse("[{},{},{}]"));
+    }
+
+    SECTION("skip in a later adaptor")
+    {
+        // max_depth has counted the elements that project skips
+        json_cursor cursor(input);
+        auto view = cursor | staj::max_depth(1) | staj::project({"/1"});
+        CHECK(read_view(view) == json::parse("[{}]"));
+    }
+
+    SECTION("staj_array over a view")
+    {
+        json_cursor cursor(input);
+        auto view = cursor | staj::project({"/*/id", "/*/name"});
+        std::vector<std::string> names;
+        for (const auto& item : staj_array<json>(view))
+        {
+            names.push_back(item.at("name").template as<std::string>() + std::to_string(item.at("id").template as<int>()));
+        }
+        CHECK(names == std::vector<std::string>{"a1", "b2", "c3"});
+    }
+
+    SECTION("adaptor over a stored view")
+    {
+        json_cursor cursor(input);
+        auto view1 = cursor | staj::project({"/*/id"});
+        auto view2 = view1 | staj::take(4);
+        std::vector<staj_event_type> expected = {staj_event_type::begin_array,
+            staj_event_type::begin_object, staj_event_type::key, staj_event_type::uint64_value};
+        CHECK(read_event_types(view2) == expected);
+    }
+}